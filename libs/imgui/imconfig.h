@@ -48,9 +48,12 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_DISABLE_FILE_MAPPING                        // Don't use mmap()/MapViewOfFile() in ImFileMap(), always read whole files into memory with ImFileLoadToMemory() instead.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_DEFAULT_FONT                        // Disable default embedded font (ProggyClean.ttf), remove ~9.5 KB from output binary. AddFontDefault() will assert.
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_NEON                                // Disable use of NEON intrinsics even if available
+//#define IMGUI_DISABLE_CRC32_DISPATCH                      // Don't detect hardware CRC32 support at runtime for ImHashData()/ImHashStr(), always use the lookup table unless compiling with SSE 4.2.
 
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
@@ -66,6 +69,10 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Switch ImGuiStorage instances holding at least this many pairs to an open-addressing hash index (e.g. window state storage of huge trees, ImGuiSelectionBasicStorage).
+// Lookups and insertions become O(1) instead of O(log N) and O(N), but pairs in ImGuiStorage::Data are then left unsorted. Default is 0 (disabled). Can be overridden per instance with ImGuiStorage::HashThreshold (-1 to disable).
+//#define IMGUI_STORAGE_HASH_THRESHOLD 1024
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -138,6 +145,9 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Name the subsystem responsible for heap allocations (IMGUI_DEBUG_HEAP_TAG_SCOPE()), for heap profilers installed with SetAllocatorFunctions().
+//#define IMGUI_ENABLE_HEAP_TAGS
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
@@ -47,8 +47,8 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiVirtualTree, Math Operators, ImColor)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage, ImGuiSelectionRangeStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Texture API (ImTextureFormat, ImTextureStatus, ImTextureRect, ImTextureData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFontBaked, ImFont)
@@ -175,6 +175,7 @@ struct ImDrawList;                  // A single draw command list (generally one
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVertCompact;           // A single vertex in the optional compact layout (fixed-point pos + normalized uv + col = 12 bytes)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
@@ -194,6 +195,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store measured item heights for ImGuiListClipper::BeginVariableHeight()
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
@@ -201,6 +203,7 @@ struct ImGuiPlatformIO;             // Interface between platform/renderer backe
 struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDataFn() function.
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
+struct ImGuiSelectionRangeStorage;  // Optional helper to store multi-selection state of very large lists as sorted index ranges + apply multi-selection requests.
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
@@ -211,6 +214,7 @@ struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
+struct ImGuiVirtualTree;            // Helper to display very large trees: flattened visible rows + compact open state, for use with ImGuiListClipper
 
 // Enumerations
 // - We don't use strongly typed enums much because they add constraints (can't extend in private code, can't store typed in bit fields, extra casting on iteration)
@@ -287,6 +291,8 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImFontAtlasParallelForFunc)(void* user_data, int jobs_count, void (*job_func)(void* job_data, int job_n), void* job_data); // Function signature for ImFontAtlas::ParallelForFunc
+typedef void    (*ImGuiBinSettingsWriteFunc)(void* user_data, void (*job_func)(void* job_data), void* job_data);                 // Function signature for io.BinSettingsWriteFunc
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // - This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -1121,6 +1127,13 @@ namespace ImGui
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
 
+    // Settings/Binary Utilities
+    // - The disk functions are automatically called instead of the .ini ones if io.BinSettingsFilename != NULL (default is NULL).
+    // - The binary file is memory-mapped on load and saves only rewrite the entries which changed since the last save (see io.BinSettingsWriteFunc to write from another thread).
+    // - The .ini functions above stay available to import/export settings as text. When the binary file doesn't exist yet, io.IniFilename is imported once.
+    IMGUI_API bool          LoadBinSettingsFromDisk(const char* filename);                      // call after CreateContext() and before the first call to NewFrame(). Return false if the file is missing or invalid.
+    IMGUI_API void          SaveBinSettingsToDisk(const char* filename);                        // this is automatically called (if io.BinSettingsFilename is not empty) a few seconds after any modification that should be reflected in the settings (and also by DestroyContext).
+
     // Debug Utilities
     // - Your main debugging friend is the ShowMetricsWindow() function, which is also accessible from Demo->Tools->Metrics Debugger
     IMGUI_API void          DebugTextEncoding(const char* text);
@@ -1133,13 +1146,14 @@ namespace ImGui
 #endif
 
     // Memory Allocators
-    // - Those functions are not reliant on the current context.
+    // - Those functions are not reliant on the current context (except MemAllocFrame).
     // - DLL users: heaps and globals are not shared across DLL boundaries! You will need to call SetCurrentContext() + SetAllocatorFunctions()
     //   for each static/DLL boundary you are calling from. Read "Context and Memory Allocators" section of imgui.cpp for more details.
     IMGUI_API void          SetAllocatorFunctions(ImGuiMemAllocFunc alloc_func, ImGuiMemFreeFunc free_func, void* user_data = NULL);
     IMGUI_API void          GetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func, ImGuiMemFreeFunc* p_free_func, void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void*         MemAllocFrame(size_t size);     // Transient allocation from the current context's frame arena. Don't free: released by next NewFrame(). Steady-state frames don't hit the heap.
 
 } // namespace ImGui
 
@@ -1720,6 +1734,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasDistanceFields = 1 << 5, // Backend Renderer supports distance field glyphs (see ImFontFlags_DistanceField and IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET). This allows a single baked font to be used at all sizes. Otherwise glyphs are resampled on CPU for each size.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2389,6 +2404,9 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    const char* BinSettingsFilename;            // = NULL           // Path to binary settings file. When set, it is used instead of IniFilename for automatic loading/saving: faster to load and only changed entries are rewritten.
+    ImGuiBinSettingsWriteFunc BinSettingsWriteFunc; // = NULL       // [BETA] Optional: run binary settings write jobs, e.g. on a worker thread. Jobs must run in submission order and be completed before the allocator functions become invalid or the process exits (DestroyContext() submits a final save, so flush after it). Requires thread-safe allocator functions. NULL = write synchronously.
+    void*       BinSettingsWriteUserData;       // = NULL           // User data passed to BinSettingsWriteFunc.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     void*       UserData;                       // = NULL           // Store your own data.
 
@@ -2419,6 +2437,10 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] Ctrl+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    size_t      ConfigMemoryCompactBudget;      // = 0              // [BETA] Budget (in bytes) for transient windows/tables/draw lists buffers and baked fonts. When the estimated total exceeds it, free least recently used ones first, regardless of ConfigMemoryCompactTimer. Set to 0 to disable. See Metrics/Debugger window for reclaimed bytes.
+    bool        ConfigDrawDataOptimize;         // = false          // [BETA] At the end of Render(), merge compatible draw commands across draw lists and drop fully clipped ones, reducing draw calls. Costs a copy of merged vertices/indices. Lists containing user callbacks are left untouched.
+    bool        ConfigDrawDataTrackChanges;     // = false          // [BETA] At the end of Render(), hash output and set ImDrawData::ContentChanged = false when identical to previous frame, so the application can skip rendering + presenting (e.g. sleep instead). Costs hashing all vertices/indices.
+    bool        ConfigTextSizeCache;            // = false          // [BETA] Cache CalcTextSize() results per (baked font, text, wrap width). Entries unused for a while are evicted. Helps with many static labels (e.g. large tables), costs hashing text. See Metrics/Debugger window for hit/miss counters.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2531,6 +2553,9 @@ struct ImGuiIO
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
+    int         MetricsRenderDrawCmds;              // Draw commands output during last call to Render() (after the io.ConfigDrawDataOptimize pass, if enabled)
+    int         MetricsRenderDrawCmdsUnoptimized;   // Draw commands output during last call to Render() before the io.ConfigDrawDataOptimize pass (== MetricsRenderDrawCmds when disabled)
+    int         MetricsRenderFramesUnchanged;       // Number of consecutive calls to Render() with unchanged output on main viewport (requires io.ConfigDrawDataTrackChanges)
     int         MetricsActiveWindows;               // Number of active windows
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
@@ -2682,7 +2707,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiVirtualTree, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2760,6 +2785,17 @@ struct ImGuiStoragePair
     ImGuiStoragePair(ImGuiID _key, void* _val)  { key = _key; val_p = _val; }
 };
 
+// [Internal] Slot of ImGuiStorage hash index (index == -1 for empty slots)
+struct ImGuiStorageHashSlot
+{
+    ImGuiID     key;
+    int         index;      // Index into ImGuiStorage::Data
+};
+
+#ifndef IMGUI_STORAGE_HASH_THRESHOLD
+#define IMGUI_STORAGE_HASH_THRESHOLD    0       // Disabled by default. See imconfig.h
+#endif
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -2768,15 +2804,21 @@ struct ImGuiStoragePair
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
 // Types are NOT stored, so it is up to you to make sure your Key don't collide with different types.
+// Opt-in: storages holding at least HashThreshold pairs switch to a hash index (O(1) lookup and insertion), in which case Data is left unsorted.
 struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStorageHashSlot>  HashIndex;          // Open-addressing table (power of two size, linear probing). Empty when Data is sorted.
+    int                             HashIndexDataSize;  // Data.Size when HashIndex was last updated. A mismatch means Data was modified directly and HashIndex needs a rebuild.
+    int                             HashThreshold;      // Use HashIndex when holding at least this many pairs. 0: use IMGUI_STORAGE_HASH_THRESHOLD (default). -1: always keep Data sorted.
+
+    ImGuiStorage()      { HashIndexDataSize = 0; HashThreshold = 0; }
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N) (or O(1) with HashIndex)
     // - Set***() functions find pair, insertion on demand if missing.
-    // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair. With HashIndex, pairs are appended.
+    void                Clear() { Data.clear(); HashIndex.clear(); HashIndexDataSize = 0; }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2796,6 +2838,7 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // Also call this after modifying Data directly: it sorts Data and rebuilds HashIndex if needed.
     IMGUI_API void      BuildSortByKey();
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
@@ -2843,12 +2886,14 @@ struct ImGuiListClipper
     double          StartSeekOffsetY;   // [Internal] Account for frozen rows in a table and initial loss of precision in very large windows.
     void*           TempData;           // [Internal] Internal data
     ImGuiListClipperFlags Flags;        // [Internal] Flags, currently not yet well exposed.
+    ImGuiListClipperHeights* Heights;   // [Internal] Item heights storage when using BeginVariableHeight(), NULL otherwise
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step, and you can call SeekCursorForItem() manually if you need)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights); // Items may have different heights, measured as they are displayed and stored in 'heights' which you need to persist (one per list). Steps are one item each.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2869,6 +2914,81 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of items for ImGuiListClipper::BeginVariableHeight().
+// - Items which haven't been displayed yet are assumed to be DefaultHeight tall. Heights are measured as items are displayed,
+//   so the scrollbar converges toward the real content height as the list gets browsed.
+// - Heights are accumulated in a Fenwick tree (binary indexed tree): updating one height, getting the position of an item
+//   and finding the item at a given position are all O(log N), so lists of millions of items can be clipped cheaply.
+// - Storage is automatically resized to the count passed to BeginVariableHeight(): appending items (e.g. a growing log) is O(log N) per item.
+//   Call Clear() if the items were changed, e.g. after sorting or filtering.
+// Usage:
+//   static ImGuiListClipperHeights heights;
+//   ImGuiListClipper clipper;
+//   clipper.BeginVariableHeight(lines.Size, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", lines[i]);
+struct ImGuiListClipperHeights
+{
+    float               DefaultHeight;  // = 0.0f   // Height assumed for items which haven't been measured yet. Set before first use. 0.0f: use GetTextLineHeightWithSpacing().
+    ImVector<float>     Heights;        // [Internal] Measured height of each item, or -1.0f if not measured yet
+    ImVector<double>    Tree;           // [Internal] Fenwick tree of item heights (Tree[i - 1] holds the sum of items (i - (i & -i), i])
+
+    ImGuiListClipperHeights()           { DefaultHeight = 0.0f; }
+    IMGUI_API void      Clear();                                    // Forget all items and measurements
+    IMGUI_API void      Resize(int items_count);                    // Add items (assumed DefaultHeight) or remove items at the end
+    IMGUI_API void      SetItemHeight(int item_n, float height);
+    IMGUI_API double    GetItemPos(int item_n) const;               // Sum of heights of items before 'item_n'
+    IMGUI_API int       FindItemAtPos(double pos) const;            // Index of the item covering 'pos' (clamped to valid items)
+    int                 GetItemsCount() const                       { return Heights.Size; }
+    float               GetItemHeight(int item_n) const             { return Heights[item_n] >= 0.0f ? Heights[item_n] : DefaultHeight; }
+    double              GetTotalHeight() const                      { return GetItemPos(Heights.Size); }
+};
+
+// Helper: Display very large trees (e.g. 500k+ nodes) by only submitting visible rows.
+// - TreeNode() requires submitting every node of every open parent, and stores open state of each node in the window storage.
+// - Instead, we keep a flattened array of currently visible rows (node index + depth), which can be clipped with ImGuiListClipper.
+//   Opening/closing a node inserts/removes its visible descendants in place. Open state is one bit per node.
+// - Nodes are identified by an index in your own data. The hierarchy is queried via the two adapter functions (node -1 = root).
+// - TreeNodeRow() submits a tree node indented according to its depth and records toggles, which are applied by ApplyToggledRows()
+//   once you are done with the clipper loop, so rows don't move while being submitted.
+// Usage:
+//   static ImGuiVirtualTree tree;                      // Set UserData + Adapter functions, then call Build() once
+//   ImGuiListClipper clipper;
+//   clipper.Begin(tree.Rows.Size);
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           tree.TreeNodeRow(row_n, my_nodes[tree.Rows[row_n].NodeIdx].Name);
+//   tree.ApplyToggledRows();
+struct ImGuiVirtualTreeRow
+{
+    int                 NodeIdx;        // Node index (as used by adapter functions)
+    int                 Depth;          // 0 for children of the root
+};
+
+struct ImGuiVirtualTree
+{
+    // Members
+    void*               UserData;       // = NULL   // User data for use by adapter functions            // e.g. tree.UserData = (void*)my_nodes;
+    int                 (*AdapterGetChildrenCount)(ImGuiVirtualTree* self, int node_idx);               // Return number of children of 'node_idx' (-1 for root)
+    int                 (*AdapterGetChild)(ImGuiVirtualTree* self, int node_idx, int child_n);          // Return node index of child 'child_n' of 'node_idx' (-1 for root)
+    ImVector<ImGuiVirtualTreeRow> Rows; // Visible rows, in display order. Rebuilt by Build(), updated by SetRowOpen()/SetNodeOpen()/ApplyToggledRows().
+    ImVector<ImU32>     _OpenBits;      // [Internal] One bit per node index: set if node is open
+    ImVector<int>       _ToggledRows;   // [Internal] Rows toggled by TreeNodeRow() this frame
+    ImVector<ImGuiVirtualTreeRow> _TempRows;   // [Internal] Scratch buffer used when opening a node
+    ImVector<int>       _TempStack;     // [Internal] Scratch buffer used when walking the hierarchy
+
+    // Methods
+    IMGUI_API ImGuiVirtualTree();
+    IMGUI_API void      Clear();                                    // Forget rows and open state
+    IMGUI_API void      Build();                                    // Rebuild Rows from the hierarchy and current open state. Call once, and again when your hierarchy changes.
+    IMGUI_API bool      IsNodeOpen(int node_idx) const;
+    IMGUI_API void      SetRowOpen(int row_n, bool open);           // Open/close node displayed at 'row_n', cost is O(rows) to insert/remove its visible descendants
+    IMGUI_API void      SetNodeOpen(int node_idx, bool open);       // Open/close any node, visible or not. If visible, this searches its row (O(rows)).
+    IMGUI_API bool      TreeNodeRow(int row_n, const char* label, ImGuiTreeNodeFlags flags = 0); // Submit row 'row_n' as a tree node. Return true if open. Toggle is applied by ApplyToggledRows().
+    IMGUI_API void      ApplyToggledRows();                         // Apply toggles recorded by TreeNodeRow(). Call after the clipper loop.
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2951,7 +3071,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage, ImGuiSelectionRangeStorage)
 //-----------------------------------------------------------------------------
 
 // Multi-selection system
@@ -3099,6 +3219,33 @@ struct ImGuiSelectionExternalStorage
     IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests by using AdapterSetItemSelected() calls
 };
 
+// Optional helper to store multi-selection state of very large lists as sorted ranges of item indices.
+// - Selecting or unselecting a range costs O(log R + R) where R is the number of ranges, regardless of how many items the range contains.
+//   Ctrl+A over 10M items stores a single range, whereas ImGuiSelectionBasicStorage would store and sort 10M entries.
+// - Contains() is O(log R). Iterate with 'void* it = NULL; int idx; while (selection.GetNextSelectedItem(&it, &idx)) { ... }'
+//   or more efficiently range by range with GetNextSelectedRange().
+// - Items are identified by their index (pass it to SetNextItemSelectionUserData()), so there is no adapter. If your items get
+//   reordered, inserted or deleted you need to update the selection yourself, or use ImGuiSelectionBasicStorage with persistent IDs.
+// - Does not preserve selection order.
+struct ImGuiSelectionRangeStorage
+{
+    // Members
+    int             Size;           //          // Number of selected items, maintained by this helper.
+    ImVector<int>   _Ranges;        // [Internal] Sorted, disjoint and non-adjacent [begin, end) ranges of selected indices, stored as begin0, end0, begin1, end1...
+
+    // Methods
+    IMGUI_API ImGuiSelectionRangeStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(int idx) const;                    // Query if an item index is in selection.
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionRangeStorage& r);        // Swap two selections
+    IMGUI_API void  SetRangeSelected(int first_idx, int last_idx, bool selected); // Add/remove items [first_idx..last_idx] (inclusive) to/from selection
+    inline void     SetItemSelected(int idx, bool selected)     { SetRangeSelected(idx, idx, selected); }
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, int* out_idx);                        // Iterate selected items in increasing order
+    IMGUI_API bool  GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last);      // Iterate selected ranges in increasing order, 'out_last' is inclusive
+    inline int      GetRangesCount() const                      { return _Ranges.Size / 2; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
@@ -3173,6 +3320,20 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// [BETA] Optional compact vertex layout (12 bytes instead of 20), produced from ImDrawVert by ImDrawList::BuildCompactVtxBuffer().
+// Renderer backends may upload this instead of ImDrawList::VtxBuffer[] to reduce vertex bandwidth:
+// - pos: unsigned fixed-point with IM_DRAWVERT_COMPACT_POS_SCALE subdivisions per pixel, relative to an origin returned with the buffer.
+//        A backend typically folds 'origin' and '1/IM_DRAWVERT_COMPACT_POS_SCALE' into its projection matrix.
+// - uv:  unsigned normalized 16-bit (0..65535 maps to 0.0f..1.0f).
+// - col: same as ImDrawVert.
+#define IM_DRAWVERT_COMPACT_POS_SCALE   8.0f    // 1/8th of a pixel precision, a draw list may span up to 8191 pixels.
+struct ImDrawVertCompact
+{
+    ImU16   pos[2];
+    ImU16   uv[2];
+    ImU32   col;
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -3351,6 +3512,8 @@ struct ImDrawList
     // Advanced: Miscellaneous
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer. For multi-threaded rendering, consider using `imgui_threaded_rendering` from https://github.com/ocornut/imgui_club instead.
+    IMGUI_API ImU64 CalcContentHash() const;                                    // Hash of CmdBuffer/IdxBuffer/VtxBuffer contents. Two lists with same hash render the same output (provided textures and callbacks are unchanged).
+    IMGUI_API bool  BuildCompactVtxBuffer(ImVector<ImDrawVertCompact>* out_vtx, ImVec2* out_origin) const; // [BETA] Convert VtxBuffer[] to the compact layout. Return false if contents can't be represented (span larger than 8191 pixels, or UV outside of 0..1 e.g. wrapping user textures).
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -3415,6 +3578,9 @@ struct ImDrawData
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Copied from viewport->FramebufferScale (== io.DisplayFramebufferScale for main viewport). Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
     ImVector<ImTextureData*>* Textures;     // List of textures to update. Most of the times the list is shared by all ImDrawData, has only 1 texture and it doesn't need any update. This almost always points to ImGui::GetPlatformIO().Textures[]. May be overridden or set to NULL if you want to manually update textures.
+    ImU64               ContentHash;        // Hash of all draw lists + display parameters. Only computed when io.ConfigDrawDataTrackChanges is set, otherwise 0.
+    bool                ContentChanged;     // == false when output is identical to previous frame (requires io.ConfigDrawDataTrackChanges): the application may skip rendering and presenting entirely. Always true otherwise. Also true with no DamageRects[] when textures need updating.
+    ImVector<ImVec4>    DamageRects;        // Areas which differ from previous frame, one per changed draw list (~window), same coordinates as ImDrawCmd::ClipRect. Requires io.ConfigDrawDataTrackChanges, otherwise always the whole display. A renderer drawing over a preserved framebuffer may restrict clearing/drawing to those areas.
 
     // Functions
     ImDrawData()    { Clear(); }
@@ -3422,6 +3588,7 @@ struct ImDrawData
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API ImU64 CalcContentHash() const;                // Helper to hash all draw lists + display parameters. Called by Render() when io.ConfigDrawDataTrackChanges is set.
 };
 
 //-----------------------------------------------------------------------------
@@ -3519,6 +3686,7 @@ struct ImFontConfig
     void*           FontData;               //          // TTF/OTF data
     int             FontDataSize;           //          // TTF/OTF data size
     bool            FontDataOwnedByAtlas;   // true     // TTF/OTF data ownership taken by the owner ImFontAtlas (will delete memory itself).
+    bool            FontDataMapFile;        // false    // AddFontFromFileTTF(): map file read-only instead of reading it into heap memory. Pages are shared between processes and only faulted in when accessed. Useful for large font collections (e.g. CJK .ttc files).
 
     // Options
     bool            MergeMode;              // false    // Merge into previous ImFont, so you can combine multiple inputs font into one ImFont (e.g. ASCII font + icons + Japanese glyphs). You may want to use GlyphOffset.y when merge font of different heights.
@@ -3539,6 +3707,7 @@ struct ImFontConfig
     unsigned int    FontLoaderFlags;        // 0        // Settings for custom font builder. THIS IS BUILDER IMPLEMENTATION DEPENDENT. Leave as zero if unsure.
     //unsigned int  FontBuilderFlags;       // --       // [Renamed in 1.92] Ue FontLoaderFlags.
     float           RasterizerMultiply;     // 1.0f     // Linearly brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable. This is a silly thing we may remove in the future.
+    float           RasterizerGamma;        // 1.0f     // Gamma curve applied to font output after RasterizerMultiply: <1.0f thickens, >1.0f thins. Not applied to ImFontFlags_DistanceField fonts.
     float           RasterizerDensity;      // 1.0f     // [LEGACY: this only makes sense when ImGuiBackendFlags_RendererHasTextures is not supported] DPI scale multiplier for rasterization. Not altering other font metrics: makes it easy to swap between e.g. a 100% and a 400% fonts for a zooming display, or handle Retina screen. IMPORTANT: If you change this it is expected that you increase/decrease font scale roughly to the inverse of this, otherwise quality may look lowered.
 
     // [Internal]
@@ -3546,6 +3715,7 @@ struct ImFontConfig
     ImFont*         DstFont;                // Target font (as we merging fonts, multiple ImFontConfig may target the same font)
     const ImFontLoader* FontLoader;         // Custom font backend for this source (default source is the one stored in ImFontAtlas)
     void*           FontLoaderData;         // Font loader opaque storage (per font config)
+    bool            FontDataIsMapped;       // FontData is a read-only file mapping owned by the atlas, released with ImFileUnmap().
 
     IMGUI_API ImFontConfig();
 };
@@ -3566,6 +3736,12 @@ struct ImFontGlyph
     ImFontGlyph()   { memset(this, 0, sizeof(*this)); PackId = -1; }
 };
 
+// Distance field glyphs (ImFontFlags_DistanceField) are tagged by adding this to U coordinates.
+// A renderer supporting ImGuiBackendFlags_RendererHasDistanceFields should, for fragments where U >= IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET:
+// sample alpha at (U - IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET, V), and output alpha = saturate((alpha - 0.5) / fwidth(alpha) + 0.5).
+// Only textures owned by dear imgui (ImDrawCmd::TexRef._TexData != NULL) may contain them: user textures may legitimately use U >= 2.0f.
+#define IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET   2.0f
+
 // Helper to build glyph ranges from text/string data. Feed your application strings/characters to it then call BuildRanges().
 // This is essentially a tightly packed of vector of 64k booleans = 8KB storage.
 struct ImFontGlyphRangesBuilder
@@ -3643,6 +3819,12 @@ struct ImFontAtlas
     IMGUI_API void              CompactCache();             // Compact cached glyphs and texture.
     IMGUI_API void              SetFontLoader(const ImFontLoader* font_loader); // Change font loader at runtime.
 
+    // Glyph cache (BETA): persist baked glyphs (metrics + bitmaps) to disk, so they can be restored on next run without invoking the font loader.
+    // - Entries are keyed by font data fingerprint + source settings + size + density. Entries not matching a currently added font are ignored.
+    // - Call LoadGlyphCache() after adding fonts, SaveGlyphCache() e.g. before shutdown. Both return false on I/O error or invalid file.
+    IMGUI_API bool              LoadGlyphCache(const char* filename);
+    IMGUI_API bool              SaveGlyphCache(const char* filename);
+
     // As we are transitioning toward a new font system, we expect to obsolete those soon:
     IMGUI_API void              ClearInputData();           // [OBSOLETE] Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearFonts();               // [OBSOLETE] Clear input+output font data (same as ClearInputData() + glyphs storage, UV coordinates).
@@ -3724,6 +3906,9 @@ struct ImFontAtlas
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    ImFontAtlasParallelForFunc  ParallelForFunc;    // [BETA] Optional: when a text uses many glyphs which are not loaded yet (e.g. CJK), their rasterization is split into jobs which this function should run in parallel, e.g. on a thread pool, returning once all completed. Packing and texture updates stay on the calling thread. Requires thread-safe allocator functions.
+    void*                       ParallelForUserData;// User data passed to ParallelForFunc.
+    int                         ParallelForJobsMax; // Maximum number of jobs requested from ParallelForFunc (~number of worker threads). Default to 4.
 
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
@@ -3739,6 +3924,7 @@ struct ImFontAtlas
     ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
+    bool                        RendererHasDistanceFields; // Copy of (BackendFlags & ImGuiBackendFlags_RendererHasDistanceFields) from supporting context.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format or conversion process.
     ImVec2                      TexUvScale;         // = (1.0f/TexData->TexWidth, 1.0f/TexData->TexHeight). May change as new texture gets created.
@@ -3779,13 +3965,14 @@ struct ImFontAtlas
 struct ImFontBaked
 {
     // [Internal] Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Paged. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI). Codepoints 0..255 are at their own index.
     float                       FallbackAdvanceX;   // 4     // out // FindGlyph(FallbackChar)->AdvanceX
     float                       Size;               // 4     // in  // Height of characters/line, set during loading (doesn't change after loading)
     float                       RasterizerDensity;  // 4     // in  // Density this is baked at
 
     // [Internal] Members: Hot ~28/36 bytes (for RenderText loop)
-    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Paged. Index glyphs by Unicode code-point. Codepoints 0..255 are at their own index.
+    ImVector<ImU16>             IndexPageMap;       // 12-16 // out // Page number in IndexLookup[]/IndexAdvanceX[] for each block of 256 code-points (0: not allocated), so a few CJK or emoji glyphs don't require 64K+ entries.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out // All glyphs.
     int                         FallbackGlyphIndex; // 4     // out // Index of FontFallbackChar
 
@@ -3795,6 +3982,7 @@ struct ImFontBaked
     unsigned int                WantDestroy:1;         // 0  //     // Queued for destroy
     unsigned int                LoadNoFallback:1;      // 0  //     // Disable loading fallback in lower-level calls.
     unsigned int                LoadNoRenderOnLayout:1;// 0  //     // Enable a two-steps mode where CalcTextSize() calls will load AdvanceX *without* rendering/packing glyphs. Only advantagous if you know that the glyph is unlikely to actually be rendered, otherwise it is slower because we'd do one query on the first CalcTextSize and one query on the first Draw.
+    unsigned int                DistanceField:1;       // 0  //     // Glyph bitmaps are signed distance fields and glyph U0/U1 are offset by IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET (see ImFontFlags_DistanceField).
     int                         LastUsedFrame;         // 4  //     // Record of that time this was bounds
     ImGuiID                     BakedId;            // 4     //     // Unique ID for this baked storage
     ImFont*                     OwnerFont;          // 4-8   // in  // Parent font
@@ -3817,6 +4005,7 @@ enum ImFontFlags_
     ImFontFlags_NoLoadError             = 1 << 1,   // Disable throwing an error/assert when calling AddFontXXX() with missing file/data. Calling code is expected to check AddFontXXX() return value.
     ImFontFlags_NoLoadGlyphs            = 1 << 2,   // [Internal] Disable loading new glyphs.
     ImFontFlags_LockBakedSizes          = 1 << 3,   // [Internal] Disable loading new baked sizes, disable garbage collecting current ones. e.g. if you want to lock a font to a single size. Important: if you use this to preload given sizes, consider the possibility of multiple font density used on Retina display.
+    ImFontFlags_DistanceField           = 1 << 4,   // [BETA] Bake glyphs once as signed distance fields and render them at any size. Requires a loader supporting it (stb_truetype). With ImGuiBackendFlags_RendererHasDistanceFields a single baked font is used for all sizes, otherwise each size is resampled on CPU from the distance fields (no outline rasterization).
 };
 
 // Font runtime data and rendering
@@ -523,6 +523,14 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving).");
             ImGui::Checkbox("io.ConfigMacOSXBehaviors", &io.ConfigMacOSXBehaviors);
             ImGui::SameLine(); HelpMarker("Swap Cmd<>Ctrl keys, enable various MacOS style behaviors.");
+            ImGui::Checkbox("io.ConfigTextSizeCache", &io.ConfigTextSizeCache);
+            ImGui::SameLine(); HelpMarker("[BETA] Cache CalcTextSize() results, evicting entries unused for a while.\nSee Metrics/Debugger window for hit/miss counters.");
+
+            ImGui::SeparatorText("Rendering");
+            ImGui::Checkbox("io.ConfigDrawDataOptimize", &io.ConfigDrawDataOptimize);
+            ImGui::SameLine(); HelpMarker("[BETA] Merge compatible draw commands across draw lists and drop fully clipped ones at the end of Render().\nSee Metrics/Debugger window for draw command counts.");
+            ImGui::Checkbox("io.ConfigDrawDataTrackChanges", &io.ConfigDrawDataTrackChanges);
+            ImGui::SameLine(); HelpMarker("[BETA] Hash output at the end of Render() and set ImDrawData::ContentChanged = false when identical to previous frame, and fill ImDrawData::DamageRects[] with changed areas.\nApplication/renderer needs to check them to skip rendering + presenting or only redraw damaged areas.");
             ImGui::Text("Also see Style->Rendering for rendering options.");
 
             // Also read: https://github.com/ocornut/imgui/wiki/Error-Handling
@@ -577,6 +585,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasTextures",  &io.BackendFlags, ImGuiBackendFlags_RendererHasTextures);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasDistanceFields", &io.BackendFlags, ImGuiBackendFlags_RendererHasDistanceFields);
             ImGui::EndDisabled();
 
             ImGui::TreePop();
@@ -2772,6 +2781,48 @@ static void DemoWindowWidgetsSelectionAndMultiSelect(ImGuiDemoWindowData* demo_d
             ImGui::TreePop();
         }
 
+        // Demonstrate storing the selection of a very large list as index ranges
+        IMGUI_DEMO_MARKER("Widgets/Selection State/Multi-Select (with range storage)");
+        if (ImGui::TreeNode("Multi-Select (with range storage)"))
+        {
+            // Pass index to SetNextItemSelectionUserData(), store ranges of indices in selection
+            static ImGuiSelectionRangeStorage selection;
+
+            ImGui::Text("Added features:");
+            ImGui::BulletText("Using ImGuiSelectionRangeStorage: selecting a range doesn't depend on its number of items.");
+            ImGui::BulletText("Try Ctrl+A, or Shift+Click far away after scrolling.");
+
+            const int ITEMS_COUNT = 10000000;
+            ImGui::Text("Selection: %d/%d in %d ranges", selection.Size, ITEMS_COUNT, selection.GetRangesCount());
+            if (ImGui::BeginChild("##Basket", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiMultiSelectFlags flags = ImGuiMultiSelectFlags_ClearOnEscape | ImGuiMultiSelectFlags_BoxSelect1d;
+                ImGuiMultiSelectIO* ms_io = ImGui::BeginMultiSelect(flags, selection.Size, ITEMS_COUNT);
+                selection.ApplyRequests(ms_io);
+
+                ImGuiListClipper clipper;
+                clipper.Begin(ITEMS_COUNT);
+                if (ms_io->RangeSrcItem != -1)
+                    clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem); // Ensure RangeSrc item is not clipped.
+                while (clipper.Step())
+                {
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        char label[64];
+                        sprintf(label, "Object %08d: %s", n, ExampleNames[n % IM_ARRAYSIZE(ExampleNames)]);
+                        bool item_is_selected = selection.Contains(n);
+                        ImGui::SetNextItemSelectionUserData(n);
+                        ImGui::Selectable(label, item_is_selected);
+                    }
+                }
+
+                ms_io = ImGui::EndMultiSelect();
+                selection.ApplyRequests(ms_io);
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
+
         // Demonstrate dynamic item list + deletion support using the BeginMultiSelect/EndMultiSelect API.
         // In order to support Deletion without any glitches you need to:
         // - (1) If items are submitted in their own scrolling area, submit contents size SetNextWindowContentSize() ahead of time to prevent one-frame readjustment of scrolling.
@@ -4170,6 +4221,50 @@ static void DemoWindowWidgetsTreeNodes()
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+
+        // Use ImGuiVirtualTree + ImGuiListClipper to only submit visible rows of a very large tree.
+        IMGUI_DEMO_MARKER("Widgets/Tree Nodes/Virtualized tree");
+        if (ImGui::TreeNode("Virtualized tree"))
+        {
+            // Procedural hierarchy: 100 roots x 100 children x 50 leaves = 510100 nodes.
+            // Nodes 0..99 are roots, followed by their children, followed by leaves.
+            struct Funcs
+            {
+                static int GetChildrenCount(ImGuiVirtualTree*, int node_idx) { return (node_idx < 0) ? 100 : (node_idx < 100) ? 100 : (node_idx < 10100) ? 50 : 0; }
+                static int GetChild(ImGuiVirtualTree*, int node_idx, int child_n) { return (node_idx < 0) ? child_n : (node_idx < 100) ? 100 + node_idx * 100 + child_n : 10100 + (node_idx - 100) * 50 + child_n; }
+            };
+            static ImGuiVirtualTree tree;
+            if (tree.AdapterGetChild == NULL)
+            {
+                tree.AdapterGetChildrenCount = Funcs::GetChildrenCount;
+                tree.AdapterGetChild = Funcs::GetChild;
+                tree.Build();
+            }
+            HelpMarker("Only visible rows are submitted. Open state is stored in one bit per node instead of the window storage.");
+            ImGui::Text("%d nodes, %d visible rows", 10100 + 100 * 100 * 50, tree.Rows.Size);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Collapse all"))
+            {
+                tree.Clear();
+                tree.Build();
+            }
+            if (ImGui::BeginChild("##Tree", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiListClipper clipper;
+                clipper.Begin(tree.Rows.Size);
+                while (clipper.Step())
+                    for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                    {
+                        const int node_idx = tree.Rows[row_n].NodeIdx;
+                        char label[32];
+                        sprintf(label, "%s %d", (node_idx < 100) ? "Root" : (node_idx < 10100) ? "Node" : "Leaf", node_idx);
+                        tree.TreeNodeRow(row_n, label, ImGuiTreeNodeFlags_SpanAvailWidth);
+                    }
+                tree.ApplyToggledRows();
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 }
@@ -8233,12 +8328,16 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigDrawDataOptimize)                                  ImGui::Text("io.ConfigDrawDataOptimize");
+        if (io.ConfigDrawDataTrackChanges)                              ImGui::Text("io.ConfigDrawDataTrackChanges");
+        if (io.ConfigTextSizeCache)                                     ImGui::Text("io.ConfigTextSizeCache");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasTextures)    ImGui::Text(" RendererHasTextures");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasDistanceFields) ImGui::Text(" RendererHasDistanceFields");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexData->Width, io.Fonts->TexData->Height);
         ImGui::Text("io.Fonts->FontLoaderName: %s", io.Fonts->FontLoaderName ? io.Fonts->FontLoaderName : "NULL");
@@ -9562,7 +9661,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Variable height items, clipped\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -9598,6 +9698,29 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Items of different heights (here every 5th line is wrapped): heights are measured as items get displayed.
+            // The ImGuiListClipperHeights storage needs to persist, and be cleared if the items are changed.
+            static ImGuiListClipperHeights heights;
+            static float heights_wrap_width = 0.0f;
+            if (heights_wrap_width != ImGui::GetContentRegionAvail().x)
+            {
+                heights.Clear(); // Width changed: wrapped lines need to be measured again
+                heights_wrap_width = ImGui::GetContentRegionAvail().x;
+            }
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.BeginVariableHeight(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    if (i % 5 == 0)
+                        ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
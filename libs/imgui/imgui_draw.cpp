@@ -11,6 +11,7 @@ Index of this file:
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDataOptimizer
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
@@ -137,8 +138,11 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+// Glyphs rasterized on worker threads pass a per-job scratch allocator as stbtt_fontinfo::userdata (see ImGui_ImplStbTrueType_FontBakedLoadGlyphs())
+#define IMGUI_STB_TRUETYPE_USE_SCRATCH_ALLOCATOR
+static void* ImGui_ImplStbTrueType_ScratchAlloc(size_t size, void* scratch);
+#define STBTT_malloc(x,u)   ((u) ? ImGui_ImplStbTrueType_ScratchAlloc(x, u) : IM_ALLOC(x))
+#define STBTT_free(x,u)     do { if (!(u)) IM_FREE(x); } while (0)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -487,6 +491,7 @@ void ImDrawList::_ClearFreeMemory()
 // Note: For multi-threaded rendering, consider using `imgui_threaded_rendering` from https://github.com/ocornut/imgui_club
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("DrawList");
     ImDrawList* dst = IM_NEW(ImDrawList(NULL));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
@@ -495,6 +500,47 @@ ImDrawList* ImDrawList::CloneOutput() const
     return dst;
 }
 
+// Hash output buffers. ImDrawCmd() clears its padding so hashing raw commands is fine.
+// Note that callbacks contents are not hashed: callers should treat lists with user callbacks as always changed.
+ImU64 ImDrawList::CalcContentHash() const
+{
+    ImU64 hash = ImHashData64(CmdBuffer.Data, (size_t)CmdBuffer.size_in_bytes(), (ImU64)CmdBuffer.Size);
+    hash = ImHashData64(IdxBuffer.Data, (size_t)IdxBuffer.size_in_bytes(), hash);
+    hash = ImHashData64(VtxBuffer.Data, (size_t)VtxBuffer.size_in_bytes(), hash);
+    return hash;
+}
+
+// Convert VtxBuffer[] to ImDrawVertCompact. Positions are stored relative to the integer top-left of the vertices bounding box.
+bool ImDrawList::BuildCompactVtxBuffer(ImVector<ImDrawVertCompact>* out_vtx, ImVec2* out_origin) const
+{
+    const float span_max = 65535.0f / IM_DRAWVERT_COMPACT_POS_SCALE;
+    ImVec2 pos_min(FLT_MAX, FLT_MAX), pos_max(-FLT_MAX, -FLT_MAX);
+    for (const ImDrawVert& v : VtxBuffer)
+    {
+        if (v.uv.x < 0.0f || v.uv.x > 1.0f || v.uv.y < 0.0f || v.uv.y > 1.0f)
+            return false;
+        pos_min = ImMin(pos_min, v.pos);
+        pos_max = ImMax(pos_max, v.pos);
+    }
+    const ImVec2 origin = (VtxBuffer.Size > 0) ? ImFloor(pos_min) : ImVec2(0.0f, 0.0f);
+    if (VtxBuffer.Size > 0 && (pos_max.x - origin.x > span_max || pos_max.y - origin.y > span_max))
+        return false;
+
+    out_vtx->resize(VtxBuffer.Size);
+    ImDrawVertCompact* dst = out_vtx->Data;
+    for (const ImDrawVert& v : VtxBuffer)
+    {
+        dst->pos[0] = (ImU16)((v.pos.x - origin.x) * IM_DRAWVERT_COMPACT_POS_SCALE + 0.5f);
+        dst->pos[1] = (ImU16)((v.pos.y - origin.y) * IM_DRAWVERT_COMPACT_POS_SCALE + 0.5f);
+        dst->uv[0] = (ImU16)(v.uv.x * 65535.0f + 0.5f);
+        dst->uv[1] = (ImU16)(v.uv.y * 65535.0f + 0.5f);
+        dst->col = v.col;
+        dst++;
+    }
+    *out_origin = origin;
+    return true;
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -504,6 +550,11 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+    if (CmdBuffer.Size == CmdBuffer.Capacity)
+    {
+        IMGUI_DEBUG_HEAP_TAG_SCOPE("DrawList");
+        CmdBuffer.reserve(CmdBuffer._grow_capacity(CmdBuffer.Size + 1));
+    }
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -726,6 +777,16 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     draw_cmd->ElemCount += idx_count;
 
+    // Grow buffers (same policy as resize()), so only actual allocations are tagged
+    if (VtxBuffer.Size + vtx_count > VtxBuffer.Capacity || IdxBuffer.Size + idx_count > IdxBuffer.Capacity)
+    {
+        IMGUI_DEBUG_HEAP_TAG_SCOPE("DrawList");
+        if (VtxBuffer.Size + vtx_count > VtxBuffer.Capacity)
+            VtxBuffer.reserve(VtxBuffer._grow_capacity(VtxBuffer.Size + vtx_count));
+        if (IdxBuffer.Size + idx_count > IdxBuffer.Capacity)
+            IdxBuffer.reserve(IdxBuffer._grow_capacity(IdxBuffer.Size + idx_count));
+    }
+
     int vtx_buffer_old_size = VtxBuffer.Size;
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
@@ -2124,6 +2185,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("DrawList");
     IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
@@ -2154,6 +2216,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("DrawList");
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -2259,6 +2322,9 @@ void ImDrawData::Clear()
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
     Textures = NULL;
+    ContentHash = 0;
+    ContentChanged = true;
+    DamageRects.resize(0);
 }
 
 // Important: 'out_list' is generally going to be draw_data->CmdLists, but may be another temporary list
@@ -2310,6 +2376,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
 
 void ImDrawData::AddDrawList(ImDrawList* draw_list)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("DrawData");
     IM_ASSERT(CmdLists.Size == CmdListsCount);
     draw_list->_PopUnusedDrawCmd();
     ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
@@ -2343,6 +2410,160 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
 }
 
+// Order of draw lists matters, so each list hash is used as the seed of the next one.
+ImU64 ImDrawData::CalcContentHash() const
+{
+    float display_params[6] = { DisplayPos.x, DisplayPos.y, DisplaySize.x, DisplaySize.y, FramebufferScale.x, FramebufferScale.y };
+    ImU64 hash = ImHashData64(display_params, sizeof(display_params), (ImU64)CmdLists.Size);
+    for (ImDrawList* draw_list : CmdLists)
+        hash = ImHashData64(&hash, sizeof(hash), draw_list->CalcContentHash());
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataOptimizer
+//-----------------------------------------------------------------------------
+// Enabled with io.ConfigDrawDataOptimize. _TryMergeDrawCmds() only merges within a single ImDrawList while it is being built:
+// this pass runs after Render() and merges across consecutive draw lists (e.g. a window followed by its child windows), by
+// copying their contents into a shared output list and rebasing indices, then merging commands sharing ClipRect/TexRef.
+// Commands with no elements or with a clip rectangle fully outside of the display are dropped.
+//-----------------------------------------------------------------------------
+
+static inline bool ImDrawCmd_IsCulled(const ImDrawCmd* cmd, const ImVec4& display_rect)
+{
+    const ImVec4& cr = cmd->ClipRect;
+    if (cmd->ElemCount == 0 || cr.z <= cr.x || cr.w <= cr.y)
+        return true;
+    return cr.x >= display_rect.z || cr.y >= display_rect.w || cr.z <= display_rect.x || cr.w <= display_rect.y;
+}
+
+void ImDrawDataOptimizer::ClearFreeMemory()
+{
+    for (ImDrawList* draw_list : OutputLists)
+        IM_DELETE(draw_list);
+    OutputLists.clear();
+    ListCulledCount.clear();
+    OutputListsUsed = 0;
+}
+
+void ImDrawDataOptimizer::Optimize(ImDrawData* draw_data, bool allow_vtx_offset)
+{
+    const ImVec4 display_rect(draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y);
+    const unsigned int idx_max = (sizeof(ImDrawIdx) == 2) ? 0xFFFF : 0xFFFFFFFF;
+
+    // Classify source lists
+    ImVector<ImDrawList*>& lists = draw_data->CmdLists;
+    ListCulledCount.resize(lists.Size);
+    for (int list_n = 0; list_n < lists.Size; list_n++)
+    {
+        int culled_count = 0;
+        for (const ImDrawCmd& cmd : lists[list_n]->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL)
+            {
+                culled_count = -1;
+                break;
+            }
+            if (ImDrawCmd_IsCulled(&cmd, display_rect))
+                culled_count++;
+        }
+        ListCulledCount[list_n] = culled_count;
+        CmdsBefore += lists[list_n]->CmdBuffer.Size;
+    }
+    CmdListsBefore += lists.Size;
+
+    // Merge consecutive lists into output lists. 'lists' is compacted in place as we go (out_n <= list_n).
+    int out_n = 0;
+    ImDrawList* out_list = NULL;
+    for (int list_n = 0; list_n < lists.Size; list_n++)
+    {
+        ImDrawList* src_list = lists[list_n];
+        const int culled_count = ListCulledCount[list_n];
+        const bool prev_mergeable = (list_n > 0 && ListCulledCount[list_n - 1] >= 0);
+        const bool next_mergeable = (list_n + 1 < lists.Size && ListCulledCount[list_n + 1] >= 0);
+
+        // Pass through lists with callbacks, and lone lists with nothing to cull (copying them would gain nothing)
+        if (culled_count < 0 || (culled_count == 0 && !prev_mergeable && !next_mergeable))
+        {
+            out_list = NULL;
+            lists[out_n++] = src_list;
+            continue;
+        }
+
+        // Without ImGuiBackendFlags_RendererHasVtxOffset, an output list cannot exceed what ImDrawIdx can address
+        if (out_list != NULL && !allow_vtx_offset && (unsigned int)(out_list->VtxBuffer.Size + src_list->VtxBuffer.Size) > idx_max)
+            out_list = NULL;
+        if (out_list == NULL)
+        {
+            if (OutputListsUsed == OutputLists.Size)
+                OutputLists.push_back(IM_NEW(ImDrawList)(NULL));
+            out_list = OutputLists[OutputListsUsed++];
+            out_list->CmdBuffer.resize(0);
+            out_list->IdxBuffer.resize(0);
+            out_list->VtxBuffer.resize(0);
+            SegmentVtxBase = 0;
+            lists[out_n++] = out_list;
+        }
+
+        // Copy vertices
+        const unsigned int vtx_base = (unsigned int)out_list->VtxBuffer.Size;
+        out_list->VtxBuffer.resize(out_list->VtxBuffer.Size + src_list->VtxBuffer.Size);
+        memcpy(out_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.Size * sizeof(ImDrawVert));
+
+        // Copy commands, rebasing indices onto the current VtxOffset segment so commands may merge across source lists
+        for (const ImDrawCmd& src_cmd : src_list->CmdBuffer)
+        {
+            if (ImDrawCmd_IsCulled(&src_cmd, display_rect))
+            {
+                CmdsCulled++;
+                continue;
+            }
+            const ImDrawIdx* src_idx = src_list->IdxBuffer.Data + src_cmd.IdxOffset;
+            const unsigned int vtx_start = vtx_base + src_cmd.VtxOffset;
+            if (sizeof(ImDrawIdx) == 2)
+            {
+                unsigned int src_idx_max = 0;
+                for (unsigned int n = 0; n < src_cmd.ElemCount; n++)
+                    src_idx_max = ImMax(src_idx_max, (unsigned int)src_idx[n]);
+                if (vtx_start - SegmentVtxBase + src_idx_max > idx_max)
+                {
+                    IM_ASSERT(allow_vtx_offset);
+                    SegmentVtxBase = vtx_start;
+                }
+            }
+            const unsigned int idx_delta = vtx_start - SegmentVtxBase;
+            const unsigned int idx_base = (unsigned int)out_list->IdxBuffer.Size;
+            out_list->IdxBuffer.resize(out_list->IdxBuffer.Size + (int)src_cmd.ElemCount);
+            ImDrawIdx* dst_idx = out_list->IdxBuffer.Data + idx_base;
+            for (unsigned int n = 0; n < src_cmd.ElemCount; n++)
+                dst_idx[n] = (ImDrawIdx)(src_idx[n] + idx_delta);
+
+            ImDrawCmd* prev_cmd = out_list->CmdBuffer.Size > 0 ? &out_list->CmdBuffer.back() : NULL;
+            if (prev_cmd != NULL && prev_cmd->VtxOffset == SegmentVtxBase && prev_cmd->TexRef == src_cmd.TexRef && memcmp(&prev_cmd->ClipRect, &src_cmd.ClipRect, sizeof(ImVec4)) == 0 && prev_cmd->IdxOffset + prev_cmd->ElemCount == idx_base)
+            {
+                prev_cmd->ElemCount += src_cmd.ElemCount;
+                continue;
+            }
+            ImDrawCmd cmd = src_cmd;
+            cmd.VtxOffset = SegmentVtxBase;
+            cmd.IdxOffset = idx_base;
+            out_list->CmdBuffer.push_back(cmd);
+        }
+    }
+
+    // Update draw data
+    lists.resize(out_n);
+    draw_data->CmdListsCount = out_n;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    for (ImDrawList* draw_list : lists)
+    {
+        draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
+        draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+        CmdsAfter += draw_list->CmdBuffer.Size;
+    }
+    CmdListsAfter += out_n;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -2417,6 +2638,7 @@ ImFontConfig::ImFontConfig()
     OversampleV = 0; // Auto == 1
     GlyphMaxAdvanceX = FLT_MAX;
     RasterizerMultiply = 1.0f;
+    RasterizerGamma = 1.0f;
     RasterizerDensity = 1.0f;
     EllipsisChar = 0;
 }
@@ -2572,6 +2794,12 @@ void ImTextureData::DestroyPixels()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
+// - ImFontAtlasGlyphCacheGetFontKey()
+// - ImFontAtlasGlyphCacheSaveToMemory()
+// - ImFontAtlasGlyphCacheLoadFromMemory()
+// - ImFontAtlas::SaveGlyphCache()
+// - ImFontAtlas::LoadGlyphCache()
+//-----------------------------------------------------------------------------
 // - ImFontAtlasGetFontLoaderForStbTruetype()
 //-----------------------------------------------------------------------------
 
@@ -2629,6 +2857,18 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
 
 #define IM_FONTGLYPH_INDEX_UNUSED           ((ImU16)-1) // 0xFFFF
 #define IM_FONTGLYPH_INDEX_NOT_FOUND        ((ImU16)-2) // 0xFFFE
+#define IM_FONTGLYPH_INDEX_PAGE_SIZE        256         // IndexLookup[]/IndexAdvanceX[] are made of pages of 256 codepoints, allocated on demand.
+
+// Return slot of a codepoint in IndexLookup[]/IndexAdvanceX[], or a value >= their size if not allocated.
+// Page 0 (ASCII, Latin-1) is always allocated first, so its slots are the codepoints and the caller's bound check is enough.
+static inline unsigned int ImFontBaked_GetIndexSlot(const ImFontBaked* baked, unsigned int c)
+{
+    if (c < IM_FONTGLYPH_INDEX_PAGE_SIZE) IM_LIKELY
+        return c;
+    const unsigned int page_n = c / IM_FONTGLYPH_INDEX_PAGE_SIZE;
+    const unsigned int page_slot = (page_n < (unsigned int)baked->IndexPageMap.Size) ? baked->IndexPageMap.Data[page_n] : 0;
+    return page_slot ? page_slot * IM_FONTGLYPH_INDEX_PAGE_SIZE + (c % IM_FONTGLYPH_INDEX_PAGE_SIZE) : (unsigned int)-1;
+}
 
 ImFontAtlas::ImFontAtlas()
 {
@@ -2639,6 +2879,7 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    ParallelForJobsMax = 4;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
@@ -2740,8 +2981,9 @@ static void ImFontAtlasBuildUpdateRendererHasTexturesFromContext(ImFontAtlas* at
 // If you manually manage font atlases, you'll need to call this yourself.
 // - 'frame_count' needs to be provided because we can gc/prioritize baked fonts based on their age.
 // - 'frame_count' may not match those of all imgui contexts using this atlas, as contexts may be updated as different frequencies. But generally you can use ImGui::GetFrameCount() on one of your context.
-void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures)
+void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures, bool renderer_has_distance_fields)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
     IM_ASSERT(atlas->Builder == NULL || atlas->Builder->FrameCount < frame_count); // Protection against being called twice.
     atlas->RendererHasTextures = renderer_has_textures;
 
@@ -2765,6 +3007,15 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     for (ImFont* font : atlas->Fonts)
         font->LastBaked = NULL;
 
+    // Distance field fonts are baked differently depending on renderer support: discard existing bakes when it changes.
+    if (atlas->RendererHasDistanceFields != renderer_has_distance_fields)
+    {
+        atlas->RendererHasDistanceFields = renderer_has_distance_fields;
+        for (ImFont* font : atlas->Fonts)
+            if (font->Flags & ImFontFlags_DistanceField)
+                ImFontAtlasFontDiscardBakes(atlas, font, 0);
+    }
+
     // Garbage collect BakedPool
     if (builder->BakedDiscardedCount > 0)
     {
@@ -2841,7 +3092,224 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     }
 }
 
-void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
+// Row kernels for texture block conversion and post-processing.
+// SIMD versions process the bulk of a row and leave the remainder to the scalar loop, which is also used as reference by ImFontAtlasDebugSelfTestTextureBlocks().
+// Those are memory bound: 128-bit vectors are enough. Alpha is always the high byte of a RGBA32 pixel (IM_COL32_A_SHIFT == 24 in both color packings).
+static void ImFontAtlasTextureRowConvertAlpha8ToRGBA32(const ImU8* src, ImU32* dst, int w, bool use_simd)
+{
+    int nx = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    if (use_simd)
+    {
+        const __m128i ones = _mm_set1_epi8((char)0xFF);
+        for (; nx + 16 <= w; nx += 16)
+        {
+            const __m128i a = _mm_loadu_si128((const __m128i*)(const void*)(src + nx));
+            const __m128i ff_a_lo = _mm_unpacklo_epi8(ones, a);  // (0xFF, a) pairs
+            const __m128i ff_a_hi = _mm_unpackhi_epi8(ones, a);
+            _mm_storeu_si128((__m128i*)(void*)(dst + nx + 0),  _mm_unpacklo_epi16(ones, ff_a_lo));
+            _mm_storeu_si128((__m128i*)(void*)(dst + nx + 4),  _mm_unpackhi_epi16(ones, ff_a_lo));
+            _mm_storeu_si128((__m128i*)(void*)(dst + nx + 8),  _mm_unpacklo_epi16(ones, ff_a_hi));
+            _mm_storeu_si128((__m128i*)(void*)(dst + nx + 12), _mm_unpackhi_epi16(ones, ff_a_hi));
+        }
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    if (use_simd)
+    {
+        uint8x16x4_t px;
+        px.val[0] = px.val[1] = px.val[2] = vdupq_n_u8(0xFF);
+        for (; nx + 16 <= w; nx += 16)
+        {
+            px.val[3] = vld1q_u8(src + nx);
+            vst4q_u8((uint8_t*)(void*)(dst + nx), px);
+        }
+    }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; nx < w; nx++)
+        dst[nx] = IM_COL32(255, 255, 255, (unsigned int)src[nx]);
+}
+
+static void ImFontAtlasTextureRowConvertRGBA32ToAlpha8(const ImU32* src, ImU8* dst, int w, bool use_simd)
+{
+    int nx = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    if (use_simd)
+    {
+        for (; nx + 16 <= w; nx += 16)
+        {
+            const __m128i a0 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + nx + 0)), 24);
+            const __m128i a1 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + nx + 4)), 24);
+            const __m128i a2 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + nx + 8)), 24);
+            const __m128i a3 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + nx + 12)), 24);
+            _mm_storeu_si128((__m128i*)(void*)(dst + nx), _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3)));
+        }
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    if (use_simd)
+        for (; nx + 16 <= w; nx += 16)
+            vst1q_u8(dst + nx, vld4q_u8((const uint8_t*)(const void*)(src + nx)).val[3]);
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; nx < w; nx++)
+        dst[nx] = (src[nx] >> IM_COL32_A_SHIFT) & 0xFF;
+}
+
+#if defined(IMGUI_ENABLE_SSE2)
+// Scale 4 alpha values (as 32-bit lanes), truncating toward zero like the scalar (unsigned int) cast. Result is clamped by the packing instructions.
+static inline __m128i ImFontAtlasTextureMultiply4(__m128i v, __m128 factor)
+{
+    return _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(v), factor));
+}
+#elif defined(IMGUI_ENABLE_NEON)
+// Scale 16 alpha values, truncating toward zero and saturating to 0..255.
+static inline uint8x16_t ImFontAtlasTextureMultiply16(uint8x16_t v, float factor)
+{
+    const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+    const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+    const uint32x4_t r0 = vcvtq_u32_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), factor));
+    const uint32x4_t r1 = vcvtq_u32_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), factor));
+    const uint32x4_t r2 = vcvtq_u32_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), factor));
+    const uint32x4_t r3 = vcvtq_u32_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), factor));
+    return vcombine_u8(vqmovn_u16(vcombine_u16(vqmovn_u32(r0), vqmovn_u32(r1))), vqmovn_u16(vcombine_u16(vqmovn_u32(r2), vqmovn_u32(r3))));
+}
+#endif
+
+static void ImFontAtlasTextureRowMultiplyAlpha8(ImU8* p, int w, float multiply_factor, bool use_simd)
+{
+    int nx = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    if (use_simd)
+    {
+        const __m128 factor = _mm_set1_ps(multiply_factor);
+        const __m128i zero = _mm_setzero_si128();
+        for (; nx + 16 <= w; nx += 16)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(p + nx));
+            const __m128i lo = _mm_unpacklo_epi8(v, zero);
+            const __m128i hi = _mm_unpackhi_epi8(v, zero);
+            const __m128i r0 = ImFontAtlasTextureMultiply4(_mm_unpacklo_epi16(lo, zero), factor);
+            const __m128i r1 = ImFontAtlasTextureMultiply4(_mm_unpackhi_epi16(lo, zero), factor);
+            const __m128i r2 = ImFontAtlasTextureMultiply4(_mm_unpacklo_epi16(hi, zero), factor);
+            const __m128i r3 = ImFontAtlasTextureMultiply4(_mm_unpackhi_epi16(hi, zero), factor);
+            _mm_storeu_si128((__m128i*)(void*)(p + nx), _mm_packus_epi16(_mm_packs_epi32(r0, r1), _mm_packs_epi32(r2, r3)));
+        }
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    if (use_simd)
+        for (; nx + 16 <= w; nx += 16)
+            vst1q_u8(p + nx, ImFontAtlasTextureMultiply16(vld1q_u8(p + nx), multiply_factor));
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; nx < w; nx++)
+        p[nx] = (ImU8)ImMin((unsigned int)(p[nx] * multiply_factor), (unsigned int)255);
+}
+
+static void ImFontAtlasTextureRowMultiplyRGBA32(ImU32* p, int w, float multiply_factor, bool use_simd)
+{
+    int nx = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    if (use_simd)
+    {
+        const __m128 factor = _mm_set1_ps(multiply_factor);
+        const __m128i rgb_mask = _mm_set1_epi32(~IM_COL32_A_MASK);
+        for (; nx + 8 <= w; nx += 8)
+        {
+            const __m128i px0 = _mm_loadu_si128((const __m128i*)(const void*)(p + nx + 0));
+            const __m128i px1 = _mm_loadu_si128((const __m128i*)(const void*)(p + nx + 4));
+            const __m128i r0 = ImFontAtlasTextureMultiply4(_mm_srli_epi32(px0, 24), factor);
+            const __m128i r1 = ImFontAtlasTextureMultiply4(_mm_srli_epi32(px1, 24), factor);
+            const __m128i a = _mm_packus_epi16(_mm_packs_epi32(r0, r1), _mm_setzero_si128()); // 8 clamped alpha bytes
+            const __m128i a16 = _mm_unpacklo_epi8(_mm_setzero_si128(), a);                      // Alpha in high byte of 16-bit lanes
+            _mm_storeu_si128((__m128i*)(void*)(p + nx + 0), _mm_or_si128(_mm_and_si128(px0, rgb_mask), _mm_unpacklo_epi16(_mm_setzero_si128(), a16)));
+            _mm_storeu_si128((__m128i*)(void*)(p + nx + 4), _mm_or_si128(_mm_and_si128(px1, rgb_mask), _mm_unpackhi_epi16(_mm_setzero_si128(), a16)));
+        }
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    if (use_simd)
+        for (; nx + 16 <= w; nx += 16)
+        {
+            uint8x16x4_t px = vld4q_u8((const uint8_t*)(const void*)(p + nx));
+            px.val[3] = ImFontAtlasTextureMultiply16(px.val[3], multiply_factor);
+            vst4q_u8((uint8_t*)(void*)(p + nx), px);
+        }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; nx < w; nx++)
+    {
+        unsigned int a = ImMin((unsigned int)(((p[nx] >> IM_COL32_A_SHIFT) & 0xFF) * multiply_factor), (unsigned int)255);
+        p[nx] = IM_COL32((p[nx] >> IM_COL32_R_SHIFT) & 0xFF, (p[nx] >> IM_COL32_G_SHIFT) & 0xFF, (p[nx] >> IM_COL32_B_SHIFT) & 0xFF, a);
+    }
+}
+
+#if defined(IMGUI_ENABLE_NEON)
+// 256 entries table lookup: 4 x 64 bytes tables, out of range indices leave the previous result untouched.
+static inline uint8x16_t ImFontAtlasTextureLookup16(const uint8x16x4_t lut[4], uint8x16_t v)
+{
+    const uint8x16_t step = vdupq_n_u8(64);
+    uint8x16_t r = vqtbl4q_u8(lut[0], v);
+    r = vqtbx4q_u8(r, lut[1], v = vsubq_u8(v, step));
+    r = vqtbx4q_u8(r, lut[2], v = vsubq_u8(v, step));
+    r = vqtbx4q_u8(r, lut[3], vsubq_u8(v, step));
+    return r;
+}
+#endif
+
+// Apply 256 entries lookup table (e.g. gamma curve) to alpha values.
+// No byte gather on x86 before AVX-512, so SSE2 builds use the scalar loop.
+static void ImFontAtlasTextureRowLookupAlpha8(ImU8* p, int w, const ImU8* lut, bool use_simd)
+{
+    int nx = 0;
+#if defined(IMGUI_ENABLE_NEON)
+    if (use_simd)
+    {
+        uint8x16x4_t lut_v[4];
+        for (int n = 0; n < 16; n++)
+            lut_v[n / 4].val[n % 4] = vld1q_u8(lut + n * 16);
+        for (; nx + 16 <= w; nx += 16)
+            vst1q_u8(p + nx, ImFontAtlasTextureLookup16(lut_v, vld1q_u8(p + nx)));
+    }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; nx < w; nx++)
+        p[nx] = lut[p[nx]];
+}
+
+static void ImFontAtlasTextureRowLookupRGBA32(ImU32* p, int w, const ImU8* lut, bool use_simd)
+{
+    int nx = 0;
+#if defined(IMGUI_ENABLE_NEON)
+    if (use_simd)
+    {
+        uint8x16x4_t lut_v[4];
+        for (int n = 0; n < 16; n++)
+            lut_v[n / 4].val[n % 4] = vld1q_u8(lut + n * 16);
+        for (; nx + 16 <= w; nx += 16)
+        {
+            uint8x16x4_t px = vld4q_u8((const uint8_t*)(const void*)(p + nx));
+            px.val[3] = ImFontAtlasTextureLookup16(lut_v, px.val[3]);
+            vst4q_u8((uint8_t*)(void*)(p + nx), px);
+        }
+    }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; nx < w; nx++)
+        p[nx] = (p[nx] & ~IM_COL32_A_MASK) | ((ImU32)lut[(p[nx] >> IM_COL32_A_SHIFT) & 0xFF] << IM_COL32_A_SHIFT);
+}
+
+static void ImFontAtlasTextureBuildGammaLookup(ImU8 lut[256], float gamma)
+{
+    for (int n = 0; n < 256; n++)
+        lut[n] = (ImU8)ImMin((int)(ImPow(n / 255.0f, gamma) * 255.0f + 0.5f), 255);
+}
+
+static void ImFontAtlasTextureBlockConvertEx(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h, bool use_simd)
 {
     IM_ASSERT(src_pixels != NULL && dst_pixels != NULL);
     if (src_fmt == dst_fmt)
@@ -2853,22 +3321,12 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
     else if (src_fmt == ImTextureFormat_Alpha8 && dst_fmt == ImTextureFormat_RGBA32)
     {
         for (int ny = h; ny > 0; ny--, src_pixels += src_pitch, dst_pixels += dst_pitch)
-        {
-            const ImU8* src_p = (const ImU8*)src_pixels;
-            ImU32* dst_p = (ImU32*)(void*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
-                *dst_p++ = IM_COL32(255, 255, 255, (unsigned int)(*src_p++));
-        }
+            ImFontAtlasTextureRowConvertAlpha8ToRGBA32((const ImU8*)src_pixels, (ImU32*)(void*)dst_pixels, w, use_simd);
     }
     else if (src_fmt == ImTextureFormat_RGBA32 && dst_fmt == ImTextureFormat_Alpha8)
     {
         for (int ny = h; ny > 0; ny--, src_pixels += src_pitch, dst_pixels += dst_pitch)
-        {
-            const ImU32* src_p = (const ImU32*)(void*)src_pixels;
-            ImU8* dst_p = (ImU8*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
-                *dst_p++ = ((*src_p++) >> IM_COL32_A_SHIFT) & 0xFF;
-        }
+            ImFontAtlasTextureRowConvertRGBA32ToAlpha8((const ImU32*)(const void*)src_pixels, (ImU8*)dst_pixels, w, use_simd);
     }
     else
     {
@@ -2876,42 +3334,41 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
     }
 }
 
-// Source buffer may be written to (used for in-place mods).
-// Post-process hooks may eventually be added here.
-void ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data)
+static void ImFontAtlasTextureBlockPostProcessMultiplyEx(ImFontAtlasPostProcessData* data, float multiply_factor, bool use_simd)
 {
-    // Multiply operator (legacy)
-    if (data->FontSrc->RasterizerMultiply != 1.0f)
-        ImFontAtlasTextureBlockPostProcessMultiply(data, data->FontSrc->RasterizerMultiply);
+    unsigned char* pixels = (unsigned char*)data->Pixels;
+    int pitch = data->Pitch;
+    if (data->Format == ImTextureFormat_Alpha8)
+    {
+        for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
+            ImFontAtlasTextureRowMultiplyAlpha8((ImU8*)pixels, data->Width, multiply_factor, use_simd);
+    }
+    else if (data->Format == ImTextureFormat_RGBA32) //-V547
+    {
+        for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
+            ImFontAtlasTextureRowMultiplyRGBA32((ImU32*)(void*)pixels, data->Width, multiply_factor, use_simd);
+    }
+    else
+    {
+        IM_ASSERT(0);
+    }
 }
 
-void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data, float multiply_factor)
+static void ImFontAtlasTextureBlockPostProcessGammaEx(ImFontAtlasPostProcessData* data, float gamma, bool use_simd)
 {
+    ImU8 lut[256];
+    ImFontAtlasTextureBuildGammaLookup(lut, gamma);
     unsigned char* pixels = (unsigned char*)data->Pixels;
     int pitch = data->Pitch;
     if (data->Format == ImTextureFormat_Alpha8)
     {
         for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
-        {
-            ImU8* p = (ImU8*)pixels;
-            for (int nx = data->Width; nx > 0; nx--, p++)
-            {
-                unsigned int v = ImMin((unsigned int)(*p * multiply_factor), (unsigned int)255);
-                *p = (unsigned char)v;
-            }
-        }
+            ImFontAtlasTextureRowLookupAlpha8((ImU8*)pixels, data->Width, lut, use_simd);
     }
     else if (data->Format == ImTextureFormat_RGBA32) //-V547
     {
         for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
-        {
-            ImU32* p = (ImU32*)(void*)pixels;
-            for (int nx = data->Width; nx > 0; nx--, p++)
-            {
-                unsigned int a = ImMin((unsigned int)(((*p >> IM_COL32_A_SHIFT) & 0xFF) * multiply_factor), (unsigned int)255);
-                *p = IM_COL32((*p >> IM_COL32_R_SHIFT) & 0xFF, (*p >> IM_COL32_G_SHIFT) & 0xFF, (*p >> IM_COL32_B_SHIFT) & 0xFF, a);
-            }
-        }
+            ImFontAtlasTextureRowLookupRGBA32((ImU32*)(void*)pixels, data->Width, lut, use_simd);
     }
     else
     {
@@ -2919,6 +3376,87 @@ void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data
     }
 }
 
+void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
+{
+    ImFontAtlasTextureBlockConvertEx(src_pixels, src_fmt, src_pitch, dst_pixels, dst_fmt, dst_pitch, w, h, true);
+}
+
+// Source buffer may be written to (used for in-place mods).
+// Post-process hooks may eventually be added here.
+void ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data)
+{
+    // Multiply operator (legacy)
+    if (data->FontSrc->RasterizerMultiply != 1.0f)
+        ImFontAtlasTextureBlockPostProcessMultiply(data, data->FontSrc->RasterizerMultiply);
+    if (data->FontSrc->RasterizerGamma != 1.0f && data->FontSrc->RasterizerGamma > 0.0f)
+        ImFontAtlasTextureBlockPostProcessGamma(data, data->FontSrc->RasterizerGamma);
+}
+
+void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data, float multiply_factor)
+{
+    ImFontAtlasTextureBlockPostProcessMultiplyEx(data, multiply_factor, true);
+}
+
+void ImFontAtlasTextureBlockPostProcessGamma(ImFontAtlasPostProcessData* data, float gamma)
+{
+    ImFontAtlasTextureBlockPostProcessGammaEx(data, gamma, true);
+}
+
+// Compare SIMD versions of texture block conversion/post-processing with their scalar reference, on random blocks.
+// Returns false and writes the first mismatch into out_log on failure.
+bool ImFontAtlasDebugSelfTestTextureBlocks(unsigned int seed, int iterations, char* out_log, int out_log_size)
+{
+    ImU32 rng = seed ? seed : 1;
+    const char* op_names[] = { "Alpha8->RGBA32", "RGBA32->Alpha8", "Multiply Alpha8", "Multiply RGBA32", "Gamma Alpha8", "Gamma RGBA32" };
+    const int max_w = 70, max_h = 4;
+    ImU32 src[max_w * max_h], dst_ref[max_w * max_h], dst_simd[max_w * max_h];
+    for (int it = 0; it < iterations; it++)
+    {
+        const int op = (int)(ImDebugRandom(&rng) % IM_ARRAYSIZE(op_names));
+        const int w = 1 + (int)(ImDebugRandom(&rng) % max_w);
+        const int h = 1 + (int)(ImDebugRandom(&rng) % max_h);
+        const float factor = (ImDebugRandom(&rng) % 4096) / 1024.0f;
+        const float gamma = 0.25f + (ImDebugRandom(&rng) % 4096) / 1024.0f;
+        for (ImU32& v : src)
+            v = ImDebugRandom(&rng);
+        memcpy(dst_ref, src, sizeof(src));
+        memcpy(dst_simd, src, sizeof(src));
+        const int rgba_pitch = max_w * 4;
+        const bool rgba = (op & 1) != 0;
+        ImFontAtlasPostProcessData pp_ref = {}, pp_simd = {};
+        pp_ref.Format = pp_simd.Format = rgba ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+        pp_ref.Pitch = pp_simd.Pitch = rgba_pitch;
+        pp_ref.Width = pp_simd.Width = w;
+        pp_ref.Height = pp_simd.Height = h;
+        pp_ref.Pixels = dst_ref;
+        pp_simd.Pixels = dst_simd;
+        if (op == 0 || op == 1)
+        {
+            const ImTextureFormat src_fmt = (op == 0) ? ImTextureFormat_Alpha8 : ImTextureFormat_RGBA32;
+            const ImTextureFormat dst_fmt = (op == 0) ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+            ImFontAtlasTextureBlockConvertEx((const unsigned char*)src, src_fmt, rgba_pitch, (unsigned char*)dst_ref, dst_fmt, rgba_pitch, w, h, false);
+            ImFontAtlasTextureBlockConvertEx((const unsigned char*)src, src_fmt, rgba_pitch, (unsigned char*)dst_simd, dst_fmt, rgba_pitch, w, h, true);
+        }
+        else if (op == 2 || op == 3)
+        {
+            ImFontAtlasTextureBlockPostProcessMultiplyEx(&pp_ref, factor, false);
+            ImFontAtlasTextureBlockPostProcessMultiplyEx(&pp_simd, factor, true);
+        }
+        else
+        {
+            ImFontAtlasTextureBlockPostProcessGammaEx(&pp_ref, gamma, false);
+            ImFontAtlasTextureBlockPostProcessGammaEx(&pp_simd, gamma, true);
+        }
+        if (memcmp(dst_ref, dst_simd, sizeof(dst_ref)) != 0)
+        {
+            ImFormatString(out_log, (size_t)out_log_size, "FAILED: %s, %dx%d, factor %.4f, gamma %.4f (seed %u, iteration %d)", op_names[op], w, h, factor, gamma, seed, it);
+            return false;
+        }
+    }
+    ImFormatString(out_log, (size_t)out_log_size, "OK: %d iterations (seed %u)", iterations, seed);
+    return true;
+}
+
 // Fill with single color. We don't use this directly but it is convenient for anyone working on uploading custom rects.
 void ImFontAtlasTextureBlockFill(ImTextureData* dst_tex, int dst_x, int dst_y, int w, int h, ImU32 col)
 {
@@ -3008,6 +3546,7 @@ void ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width,
 
 bool ImFontAtlas::Build()
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
     ImFontAtlasBuildMain(this);
     return true;
 }
@@ -3015,6 +3554,7 @@ bool ImFontAtlas::Build()
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
     // Sanity Checks
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
     IM_ASSERT((font_cfg_in->FontData != NULL && font_cfg_in->FontDataSize > 0) || (font_cfg_in->FontLoader != NULL));
@@ -3137,7 +3677,22 @@ ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels,
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
     size_t data_size = 0;
-    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    void* data = NULL;
+    bool data_is_mapped = false;
+    if (font_cfg_template && font_cfg_template->FontDataMapFile)
+    {
+        ImFileMapping mapping;
+        if (ImFileMap(filename, &mapping))
+        {
+            data = mapping.Data;
+            data_size = mapping.Size;
+            data_is_mapped = mapping.IsMapped;
+        }
+    }
+    else
+    {
+        data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    }
     if (!data)
     {
         if (font_cfg_template == NULL || (font_cfg_template->Flags & ImFontFlags_NoLoadError) == 0)
@@ -3155,6 +3710,7 @@ ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels,
         for (p = filename + ImStrlen(filename); p > filename && p[-1] != '/' && p[-1] != '\\'; p--) {}
         ImFormatString(font_cfg.Name, IM_ARRAYSIZE(font_cfg.Name), "%s", p);
     }
+    font_cfg.FontDataIsMapped = data_is_mapped;
     return AddFontFromMemoryTTF(data, (int)data_size, size_pixels, &font_cfg, glyph_ranges);
 }
 
@@ -3253,6 +3809,7 @@ void ImFontAtlas::RemoveFont(ImFont* font)
 // At it is common to do an AddCustomRect() followed by a GetCustomRect(), we provide an optional 'ImFontAtlasRect* out_r = NULL' argument to retrieve the info straight away.
 ImFontAtlasRectId ImFontAtlas::AddCustomRect(int width, int height, ImFontAtlasRect* out_r)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
 
@@ -3370,6 +3927,7 @@ bool ImFontAtlasGetMouseCursorTexData(ImFontAtlas* atlas, ImGuiMouseCursor curso
 // When atlas->RendererHasTextures = true, this is only called if no font were loaded.
 void ImFontAtlasBuildMain(ImFontAtlas* atlas)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
     IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas!");
     if (atlas->TexData && atlas->TexData->Format != atlas->TexDesiredFormat)
         ImFontAtlasBuildClear(atlas);
@@ -3635,9 +4193,20 @@ void ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src)
     // - IT WILL THEREFORE CRASH WHEN PASSED DATA WHICH MAY NOT BE FREEED BY IMGUI.
     // - USE `ImFontConfig font_cfg; font_cfg.FontDataOwnedByAtlas = false; io.Fonts->AddFontFromMemoryTTF(....., &cfg);` to disable passing ownership/
     // WE WILL ADDRESS THIS IN A FUTURE REWORK OF THE API.
-    if (src->FontDataOwnedByAtlas)
+    if (src->FontDataIsMapped)
+    {
+        ImFileMapping mapping;
+        mapping.Data = src->FontData;
+        mapping.Size = (size_t)src->FontDataSize;
+        mapping.IsMapped = true;
+        ImFileUnmap(&mapping);
+    }
+    else if (src->FontDataOwnedByAtlas)
+    {
         IM_FREE(src->FontData);
+    }
     src->FontData = NULL;
+    src->FontDataIsMapped = false;
     if (src->GlyphExcludeRanges)
         IM_FREE((void*)src->GlyphExcludeRanges);
     src->GlyphExcludeRanges = NULL;
@@ -3774,12 +4343,15 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_ASSERT(font->FallbackChar != c && font->EllipsisChar != c); // Unsupported for simplicity
     IM_ASSERT(glyph >= baked->Glyphs.Data && glyph < baked->Glyphs.Data + baked->Glyphs.Size);
     IM_UNUSED(font);
-    baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
-    baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    const unsigned int slot = ImFontBaked_GetIndexSlot(baked, c);
+    IM_ASSERT(slot < (unsigned int)baked->IndexLookup.Size);
+    baked->IndexLookup[slot] = IM_FONTGLYPH_INDEX_UNUSED;
+    baked->IndexAdvanceX[slot] = baked->FallbackAdvanceX;
 }
 
-ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
+ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id, bool distance_field)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
     IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx\n", font_size);
     ImFontBaked* baked = atlas->Builder->BakedPool.push_back(ImFontBaked());
     baked->Size = font_size;
@@ -3787,6 +4359,7 @@ ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_si
     baked->BakedId = baked_id;
     baked->OwnerFont = font;
     baked->LastUsedFrame = atlas->Builder->FrameCount;
+    baked->DistanceField = distance_field;
 
     // Initialize backend data
     size_t loader_data_size = 0;
@@ -3820,7 +4393,7 @@ ImFontBaked* ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, f
         for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
         {
             ImFontBaked* baked = &builder->BakedPool[baked_n];
-            if (baked->OwnerFont != font || baked->WantDestroy)
+            if (baked->OwnerFont != font || baked->WantDestroy || baked->DistanceField)
                 continue;
             if (step_n == 0 && baked->RasterizerDensity != font_rasterizer_density) // First try with same density
                 continue;
@@ -3862,6 +4435,15 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
     }
     builder->BakedMap.SetVoidPtr(baked->BakedId, NULL);
     builder->BakedDiscardedCount++;
+
+    // Metrics may differ when reloaded (e.g. sources changed), invalidate text size caches of contexts using this atlas
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+        if (shared_data->Context)
+        {
+            shared_data->Context->TextSizeCache.Clear();
+            for (ImGuiTextWrapLayout& layout : shared_data->Context->TextWrapLayouts)
+                layout.Key = 0;
+        }
     baked->ClearOutputData();
     baked->WantDestroy = true;
     font->LastBaked = NULL;
@@ -4061,15 +4643,18 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 
     // Patch glyphs UV
     for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        const float u_offset = builder->BakedPool[baked_n].DistanceField ? IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET : 0.0f;
         for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
             if (glyph.PackId != ImFontAtlasRectId_Invalid)
             {
                 ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
-                glyph.U0 = (r->x) * atlas->TexUvScale.x;
+                glyph.U0 = (r->x) * atlas->TexUvScale.x + u_offset;
                 glyph.V0 = (r->y) * atlas->TexUvScale.y;
-                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
+                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x + u_offset;
                 glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
             }
+    }
 
     // Update other cached UV
     ImFontAtlasBuildUpdateLinesTexData(atlas);
@@ -4082,6 +4667,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 
 void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
     //ImFontAtlasDebugWriteTexToDisk(atlas->TexData, "Before Grow");
     ImFontAtlasBuilder* builder = atlas->Builder;
     if (old_tex_w == -1)
@@ -4414,15 +5000,37 @@ static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar
     return true;
 }
 
-static void ImFontBaked_BuildGrowIndex(ImFontBaked* baked, int new_size)
+static void ImFontBaked_BuildAddIndexPage(ImFontBaked* baked)
 {
-    IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
-    if (new_size <= baked->IndexLookup.Size)
-        return;
+    const int new_size = baked->IndexLookup.Size + IM_FONTGLYPH_INDEX_PAGE_SIZE;
     baked->IndexAdvanceX.resize(new_size, -1.0f);
     baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
 }
 
+// Return slot of a codepoint in IndexLookup[]/IndexAdvanceX[], allocating its page if needed.
+static int ImFontBaked_BuildGetOrAddIndexSlot(ImFontBaked* baked, unsigned int c)
+{
+    IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
+    unsigned int slot = ImFontBaked_GetIndexSlot(baked, c);
+    if (slot < (unsigned int)baked->IndexLookup.Size)
+        return (int)slot;
+
+    // Allocate page 0 first (so its slots match codepoints), then page of codepoint
+    if (baked->IndexLookup.Size == 0)
+        ImFontBaked_BuildAddIndexPage(baked);
+    const unsigned int page_n = c / IM_FONTGLYPH_INDEX_PAGE_SIZE;
+    if (page_n != 0)
+    {
+        if (page_n >= (unsigned int)baked->IndexPageMap.Size)
+            baked->IndexPageMap.resize((int)page_n + 1, 0);
+        baked->IndexPageMap[page_n] = (ImU16)(baked->IndexLookup.Size / IM_FONTGLYPH_INDEX_PAGE_SIZE);
+        ImFontBaked_BuildAddIndexPage(baked);
+    }
+    slot = ImFontBaked_GetIndexSlot(baked, c);
+    IM_ASSERT(slot < (unsigned int)baked->IndexLookup.Size);
+    return (int)slot;
+}
+
 static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
 {
     IM_UNUSED(atlas);
@@ -4430,23 +5038,141 @@ static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font,
         *c = (ImWchar)font->RemapPairs.GetInt((ImGuiID)*c, (int)*c);
 }
 
-static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
+static inline float ImFontAtlasTextureSampleAlphaBilinear(ImTextureData* tex, const ImTextureRect& r, float x, float y)
 {
-    ImFont* font = baked->OwnerFont;
-    ImFontAtlas* atlas = font->OwnerAtlas;
-    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+    // Clamp to edge of rectangle
+    x = ImClamp(x, 0.0f, (float)(r.w - 1));
+    y = ImClamp(y, 0.0f, (float)(r.h - 1));
+    const int x0 = (int)x, y0 = (int)y;
+    const int x1 = ImMin(x0 + 1, r.w - 1), y1 = ImMin(y0 + 1, r.h - 1);
+    const float tx = x - x0, ty = y - y0;
+    float v[4];
+    const int xs[2] = { x0, x1 }, ys[2] = { y0, y1 };
+    for (int n = 0; n < 4; n++)
     {
-        // Lazily load fallback glyph
-        if (baked->FallbackGlyphIndex == -1 && baked->LoadNoFallback == 0)
-            ImFontAtlasBuildSetupFontBakedFallback(baked);
-        return NULL;
+        const unsigned char* p = (const unsigned char*)tex->GetPixelsAt(r.x + xs[n & 1], r.y + ys[n >> 1]);
+        v[n] = (tex->Format == ImTextureFormat_Alpha8) ? (float)p[0] : (float)((*(const ImU32*)(const void*)p >> IM_COL32_A_SHIFT) & 0xFF);
     }
+    return ImLerp(ImLerp(v[0], v[1], tx), ImLerp(v[2], v[3], tx), ty);
+}
 
-    // User remapping hooks
-    ImWchar src_codepoint = codepoint;
-    ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
-
-    //char utf8_buf[5];
+// Load glyph into a regular baked font of a ImFontFlags_DistanceField font, by resampling its distance field glyph.
+// This is the CPU equivalent of rendering distance fields in a shader: coverage = saturate(0.5 + signed distance in output pixels).
+// Return false if glyph is not in font.
+static bool ImFontBaked_BuildLoadGlyphFromDistanceField(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x, ImFontGlyph** out_glyph)
+{
+    ImFont* font = baked->OwnerFont;
+    ImFontAtlas* atlas = font->OwnerAtlas;
+    ImFontBaked* df_baked = ImFontAtlasBakedGetOrAddDistanceField(atlas, font);
+    const ImFontGlyph* df_glyph = df_baked ? df_baked->FindGlyphNoFallback(codepoint) : NULL;
+    if (df_glyph == NULL)
+        return false;
+
+    ImFontConfig* src = font->Sources[df_glyph->SourceIdx];
+    const float layout_scale = baked->Size / df_baked->Size;
+    ImFontGlyph glyph;
+    glyph.Codepoint = codepoint;
+    glyph.SourceIdx = df_glyph->SourceIdx;
+    glyph.AdvanceX = df_glyph->AdvanceX * layout_scale;
+    *out_glyph = NULL;
+    if (only_load_advance_x != NULL)
+    {
+        *only_load_advance_x = glyph.AdvanceX;
+        ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, NULL, codepoint, glyph.AdvanceX);
+        return true;
+    }
+    if (df_glyph->PackId == ImFontAtlasRectId_Invalid)
+    {
+        *out_glyph = ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph);
+        return true;
+    }
+
+    // Output pixel bounds: scale glyph box, keeping vertical position relative to rounded ascent like loaders do.
+    const float df_density = src->RasterizerDensity * df_baked->RasterizerDensity;
+    const float density = src->RasterizerDensity * baked->RasterizerDensity;
+    const float df_ascent = IM_ROUND(df_baked->Ascent);
+    const float ascent = IM_ROUND(baked->Ascent);
+    int px0 = (int)ImFloor(df_glyph->X0 * layout_scale * density);
+    int py0 = (int)ImFloor(((df_glyph->Y0 - df_ascent) * layout_scale + ascent) * density);
+    const int px1 = (int)ImCeil(df_glyph->X1 * layout_scale * density);
+    const int py1 = (int)ImCeil(((df_glyph->Y1 - df_ascent) * layout_scale + ascent) * density);
+    int w = px1 - px0;
+    int h = py1 - py0;
+
+    // Resample. Encoded value 128 is on the edge, and 128 steps cover IMGUI_FONT_DISTANCE_FIELD_SPREAD distance field pixels.
+    const ImTextureRect df_r = *ImFontAtlasPackGetRect(atlas, df_glyph->PackId);
+    const float df_pixels_per_pixel = df_density / (density * layout_scale);
+    const float dist_scale = (float)IMGUI_FONT_DISTANCE_FIELD_SPREAD / 128.0f / df_pixels_per_pixel;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->TempBuffer.resize(ImMax(w * h, 1));
+    unsigned char* pixels = builder->TempBuffer.Data;
+    int trim_x0 = w, trim_y0 = h, trim_x1 = 0, trim_y1 = 0;
+    for (int y = 0; y < h; y++)
+    {
+        const float df_y = (((py0 + y + 0.5f) / density - ascent) / layout_scale + df_ascent - df_glyph->Y0) * df_density - 0.5f;
+        for (int x = 0; x < w; x++)
+        {
+            const float df_x = ((px0 + x + 0.5f) / density / layout_scale - df_glyph->X0) * df_density - 0.5f;
+            const float dist = (ImFontAtlasTextureSampleAlphaBilinear(atlas->TexData, df_r, df_x, df_y) - 128.0f) * dist_scale;
+            const unsigned char coverage = (unsigned char)(ImSaturate(0.5f + dist) * 255.0f + 0.5f);
+            pixels[y * w + x] = coverage;
+            if (coverage != 0)
+            {
+                trim_x0 = ImMin(trim_x0, x); trim_x1 = ImMax(trim_x1, x + 1);
+                trim_y0 = ImMin(trim_y0, y); trim_y1 = ImMax(trim_y1, y + 1);
+            }
+        }
+    }
+    if (trim_x0 >= trim_x1 || trim_y0 >= trim_y1)
+    {
+        *out_glyph = ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph); // Too small to cover any pixel
+        return true;
+    }
+
+    // Pack trimmed bitmap (distance field padding is mostly empty at output size)
+    const int pitch = w;
+    pixels += trim_y0 * pitch + trim_x0;
+    px0 += trim_x0;
+    py0 += trim_y0;
+    w = trim_x1 - trim_x0;
+    h = trim_y1 - trim_y0;
+    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+    if (pack_id == ImFontAtlasRectId_Invalid)
+    {
+        // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+        IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+        return false;
+    }
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+    glyph.X0 = px0 / density;
+    glyph.Y0 = py0 / density;
+    glyph.X1 = (px0 + w) / density;
+    glyph.Y1 = (py0 + h) / density;
+    glyph.Visible = true;
+    glyph.PackId = pack_id;
+    ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, &glyph, r, pixels, ImTextureFormat_Alpha8, pitch);
+    *out_glyph = ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph);
+    return true;
+}
+
+static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
+{
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
+    ImFont* font = baked->OwnerFont;
+    ImFontAtlas* atlas = font->OwnerAtlas;
+    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+    {
+        // Lazily load fallback glyph
+        if (baked->FallbackGlyphIndex == -1 && baked->LoadNoFallback == 0)
+            ImFontAtlasBuildSetupFontBakedFallback(baked);
+        return NULL;
+    }
+
+    // User remapping hooks
+    ImWchar src_codepoint = codepoint;
+    ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
+
+    //char utf8_buf[5];
     //IMGUI_DEBUG_LOG("[font] BuildLoadGlyph U+%04X (%s)\n", (unsigned int)codepoint, ImTextCharToUtf8(utf8_buf, (unsigned int)codepoint));
 
     // Special hook
@@ -4455,37 +5181,47 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         if (ImFontGlyph* glyph = ImFontAtlasBuildSetupFontBakedEllipsis(atlas, baked))
             return glyph;
 
-    // Call backend
-    char* loader_user_data_p = (char*)baked->FontLoaderDatas;
-    int src_n = 0;
-    for (ImFontConfig* src : font->Sources)
+    if ((font->Flags & ImFontFlags_DistanceField) && !baked->DistanceField)
     {
-        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
-        if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+        // Distance field font without renderer support: resample from distance field glyph instead of rasterizing outlines again for each size
+        ImFontGlyph* glyph = NULL;
+        if (ImFontBaked_BuildLoadGlyphFromDistanceField(baked, src_codepoint, only_load_advance_x, &glyph))
+            return glyph;
+    }
+    else
+    {
+        // Call backend
+        char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+        int src_n = 0;
+        for (ImFontConfig* src : font->Sources)
         {
-            if (only_load_advance_x == NULL)
+            const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+            if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
             {
-                ImFontGlyph glyph_buf;
-                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, &glyph_buf, NULL))
+                if (only_load_advance_x == NULL)
                 {
-                    // FIXME: Add hooks for e.g. #7962
-                    glyph_buf.Codepoint = src_codepoint;
-                    glyph_buf.SourceIdx = src_n;
-                    return ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
+                    ImFontGlyph glyph_buf;
+                    if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, &glyph_buf, NULL))
+                    {
+                        // FIXME: Add hooks for e.g. #7962
+                        glyph_buf.Codepoint = src_codepoint;
+                        glyph_buf.SourceIdx = src_n;
+                        return ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
+                    }
                 }
-            }
-            else
-            {
-                // Special mode but only loading glyphs metrics. Will rasterize and pack later.
-                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, NULL, only_load_advance_x))
+                else
                 {
-                    ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, src, codepoint, *only_load_advance_x);
-                    return NULL;
+                    // Special mode but only loading glyphs metrics. Will rasterize and pack later.
+                    if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, NULL, only_load_advance_x))
+                    {
+                        ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, src, codepoint, *only_load_advance_x);
+                        return NULL;
+                    }
                 }
             }
+            loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+            src_n++;
         }
-        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
-        src_n++;
     }
 
     // Lazily load fallback glyph
@@ -4495,12 +5231,123 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         ImFontAtlasBuildSetupFontBakedFallback(baked);
 
     // Mark index as not found, so we don't attempt the search twice
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = baked->FallbackAdvanceX;
-    baked->IndexLookup[codepoint] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+    const int slot = ImFontBaked_BuildGetOrAddIndexSlot(baked, codepoint);
+    baked->IndexAdvanceX[slot] = baked->FallbackAdvanceX;
+    baked->IndexLookup[slot] = IM_FONTGLYPH_INDEX_NOT_FOUND;
     return NULL;
 }
 
+// Count codepoints of a text which are missing from the baked font, output them if 'out_codepoints' is not NULL.
+static int ImFontBaked_GatherMissingCodepoints(ImFontBaked* baked, const char* text, const char* text_end, ImWchar* out_codepoints)
+{
+    ImFont* font = baked->OwnerFont;
+    int count = 0;
+    for (const char* s = text; s < text_end; )
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c < 32 || (c == font->EllipsisChar && font->EllipsisAutoBake))
+            continue;
+        const unsigned int slot = ImFontBaked_GetIndexSlot(baked, c);
+        if (slot < (unsigned int)baked->IndexLookup.Size && baked->IndexLookup.Data[slot] != IM_FONTGLYPH_INDEX_UNUSED)
+            continue;
+        if (out_codepoints)
+            out_codepoints[count] = (ImWchar)c;
+        count++;
+    }
+    return count;
+}
+
+// Load all missing glyphs of a text at once, so font loaders may spread rasterization across threads (see ImFontAtlas::ParallelForFunc).
+// Called by CalcTextSize() on first missing glyph. Codepoints which are not found or can't be loaded this way are left to ImFontBaked_BuildLoadGlyph().
+static void ImFontBaked_BuildLoadGlyphsFromText(ImFontBaked* baked, const char* text, const char* text_end)
+{
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts");
+    ImFont* font = baked->OwnerFont;
+    ImFontAtlas* atlas = font->OwnerAtlas;
+    ImGuiContext* ctx = GImGui;
+    if (atlas->ParallelForFunc == NULL || atlas->Locked || (font->Flags & (ImFontFlags_NoLoadGlyphs | ImFontFlags_DistanceField)) || ctx == NULL)
+        return;
+    if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
+        return; // Layout only loads AdvanceX in this mode, rendering will load glyphs one by one
+
+    // Gather unique missing codepoints (count them first so we can use scratch memory from the frame arena, rewound on exit)
+    int src_count = ImFontBaked_GatherMissingCodepoints(baked, text, text_end, NULL);
+    if (src_count < IMGUI_FONT_PARALLEL_LOAD_MIN_GLYPHS)
+        return;
+    ImFrameArena* arena = &ctx->FrameArena;
+    const ImFrameArenaMarker arena_marker = arena->GetMarker();
+    ImWchar* src_codepoints = arena->AllocArray<ImWchar>(src_count);
+    ImFontBaked_GatherMissingCodepoints(baked, text, text_end, src_codepoints);
+    struct Func { static int IMGUI_CDECL CodepointComparer(const void* lhs, const void* rhs) { return (int)*(const ImWchar*)lhs - (int)*(const ImWchar*)rhs; } };
+    ImQsort(src_codepoints, (size_t)src_count, sizeof(ImWchar), Func::CodepointComparer);
+    int unique_count = 1;
+    for (int n = 1; n < src_count; n++)
+        if (src_codepoints[n] != src_codepoints[unique_count - 1])
+            src_codepoints[unique_count++] = src_codepoints[n];
+    src_count = unique_count;
+    if (src_count < IMGUI_FONT_PARALLEL_LOAD_MIN_GLYPHS)
+    {
+        arena->Rewind(arena_marker);
+        return;
+    }
+
+    // Try sources in order, same as ImFontBaked_BuildLoadGlyph()
+    int* pending = arena->AllocArray<int>(src_count); // Index into src_codepoints[]
+    int pending_count = src_count;
+    for (int n = 0; n < src_count; n++)
+        pending[n] = n;
+    ImWchar* batch_codepoints = arena->AllocArray<ImWchar>(src_count);
+    int* batch_pending_idx = arena->AllocArray<int>(src_count);
+    ImFontGlyph* batch_glyphs = arena->AllocArray<ImFontGlyph>(src_count);
+    bool* batch_found = arena->AllocArray<bool>(src_count);
+    char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+    int src_n = 0;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader->FontBakedLoadGlyphs == NULL || pending_count == 0)
+            break;
+
+        int batch_count = 0;
+        for (int n = 0; n < pending_count; n++)
+        {
+            ImWchar codepoint = src_codepoints[pending[n]];
+            ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
+            if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+            {
+                batch_codepoints[batch_count] = codepoint;
+                batch_pending_idx[batch_count] = n;
+                batch_count++;
+            }
+        }
+        if (batch_count > 0)
+            loader->FontBakedLoadGlyphs(atlas, src, baked, loader_user_data_p, batch_codepoints, batch_count, batch_glyphs, batch_found);
+        for (int n = 0; n < batch_count; n++)
+        {
+            if (!batch_found[n])
+                continue;
+            ImFontGlyph* glyph = &batch_glyphs[n];
+            glyph->Codepoint = src_codepoints[pending[batch_pending_idx[n]]];
+            glyph->SourceIdx = src_n;
+            ImFontAtlasBakedAddFontGlyph(atlas, baked, src, glyph);
+            pending[batch_pending_idx[n]] = -1;
+        }
+        int new_pending_count = 0;
+        for (int n = 0; n < pending_count; n++)
+            if (pending[n] != -1)
+                pending[new_pending_count++] = pending[n];
+        pending_count = new_pending_count;
+
+        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+        src_n++;
+    }
+    arena->Rewind(arena_marker);
+}
+
 static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
 {
     if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
@@ -4523,6 +5370,13 @@ static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int
 {
     return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
 }
+
+// Same but first attempt to load all missing glyphs from remaining text in one go
+static float BuildLoadGlyphsGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint, const char* text, const char* text_end)
+{
+    ImFontBaked_BuildLoadGlyphsFromText(baked, text, text_end);
+    return baked->GetCharAdvance((ImWchar)codepoint);
+}
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
@@ -4554,6 +5408,323 @@ void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
 }
 #endif
 
+//-----------------------------------------------------------------------------
+// Glyph cache
+//-----------------------------------------------------------------------------
+// File layout (native endianness: this is a machine-local cache, not an interchange format):
+// - ImFontGlyphCacheHeader
+// - For each baked font: ImFontGlyphCacheBaked, ImFontGlyphCacheGlyph[GlyphsCount], pixels[PixelsSize]
+// Bitmaps are stored after post-processing (e.g. RasterizerMultiply): as Alpha8 unless the glyph is colored and the texture is RGBA32.
+// Records are read with memcpy() as they are not necessarily aligned.
+//-----------------------------------------------------------------------------
+
+#define IMGUI_FONT_GLYPH_CACHE_VERSION  1
+
+struct ImFontGlyphCacheHeader
+{
+    char        Magic[4];           // "IMGC"
+    ImU32       Version;            // IMGUI_FONT_GLYPH_CACHE_VERSION
+    ImU32       ImGuiVersionNum;    // IMGUI_VERSION_NUM
+    ImU32       BakedCount;
+};
+
+struct ImFontGlyphCacheBaked
+{
+    ImU64       FontKey;            // ImFontAtlasGlyphCacheGetFontKey()
+    float       Size;
+    float       RasterizerDensity;
+    ImU32       GlyphsCount;
+    ImU32       PixelsSize;
+};
+
+struct ImFontGlyphCacheGlyph
+{
+    ImU32       Codepoint;
+    ImU16       Width, Height;      // 0 when glyph has no pixels
+    ImU32       Flags;              // 1: Visible, 2: Colored, 4: RGBA32 pixels (otherwise Alpha8), bits 8..11: SourceIdx
+    float       AdvanceX;
+    float       X0, Y0, X1, Y1;
+    ImU32       PixelsOffset;       // Offset into pixels of parent ImFontGlyphCacheBaked
+};
+
+// Fingerprint everything which affects baked output: font data, source settings, remapping and loaders.
+// Font data is sampled (size + first and last 64 KB) rather than fully hashed, so computing keys doesn't fault in every page of a large
+// memory-mapped font collection. The sfnt table directory and its per-table checksums are at the start of the file.
+ImU64 ImFontAtlasGlyphCacheGetFontKey(ImFontAtlas* atlas, ImFont* font)
+{
+    if (font->Sources.Size == 0)
+        return 0;
+
+    struct SourceSettings
+    {
+        ImU32   FontNo;
+        ImU32   FontLoaderFlags;
+        ImS32   OversampleH, OversampleV;
+        ImS32   PixelSnapH, PixelSnapV;
+        float   SizePixels, RasterizerMultiply, RasterizerGamma, RasterizerDensity;
+        float   GlyphOffsetX, GlyphOffsetY, GlyphMinAdvanceX, GlyphMaxAdvanceX, GlyphExtraAdvanceX;
+    };
+
+    ImU64 key = ImHashData64(&atlas->FontLoaderFlags, sizeof(atlas->FontLoaderFlags), IMGUI_FONT_GLYPH_CACHE_VERSION);
+    key = ImHashData64(&font->EllipsisChar, sizeof(font->EllipsisChar), key);
+    for (const ImGuiStoragePair& pair : font->RemapPairs.Data)
+    {
+        const ImU32 remap[2] = { pair.key, (ImU32)pair.val_i };
+        key = ImHashData64(remap, sizeof(remap), key);
+    }
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader != NULL && loader->Name != NULL)
+            key = ImHashData64(loader->Name, ImStrlen(loader->Name), key);
+
+        const size_t data_size = (size_t)src->FontDataSize;
+        const size_t sample_size = ImMin(data_size, (size_t)64 * 1024);
+        key = ImHashData64(&data_size, sizeof(data_size), key);
+        if (src->FontData != NULL)
+        {
+            key = ImHashData64(src->FontData, sample_size, key);
+            key = ImHashData64((const char*)src->FontData + data_size - sample_size, sample_size, key);
+        }
+
+        SourceSettings settings;
+        settings.FontNo = src->FontNo;
+        settings.FontLoaderFlags = src->FontLoaderFlags;
+        settings.OversampleH = src->OversampleH;
+        settings.OversampleV = src->OversampleV;
+        settings.PixelSnapH = src->PixelSnapH;
+        settings.PixelSnapV = src->PixelSnapV;
+        settings.SizePixels = src->SizePixels;
+        settings.RasterizerMultiply = src->RasterizerMultiply;
+        settings.RasterizerGamma = src->RasterizerGamma;
+        settings.RasterizerDensity = src->RasterizerDensity;
+        settings.GlyphOffsetX = src->GlyphOffset.x;
+        settings.GlyphOffsetY = src->GlyphOffset.y;
+        settings.GlyphMinAdvanceX = src->GlyphMinAdvanceX;
+        settings.GlyphMaxAdvanceX = src->GlyphMaxAdvanceX;
+        settings.GlyphExtraAdvanceX = src->GlyphExtraAdvanceX;
+        key = ImHashData64(&settings, sizeof(settings), key);
+
+        const ImWchar* ranges_list[] = { src->GlyphRanges, src->GlyphExcludeRanges };
+        for (const ImWchar* ranges : ranges_list)
+        {
+            int ranges_count = 0;
+            if (ranges != NULL)
+                while (ranges[ranges_count] != 0)
+                    ranges_count++;
+            key = ImHashData64(&ranges_count, sizeof(ranges_count), key);
+            key = ImHashData64(ranges, ranges_count * sizeof(ImWchar), key);
+        }
+    }
+    return key ? key : 1;
+}
+
+static void ImFontAtlasGlyphCacheWrite(ImVector<char>* buf, const void* data, size_t data_size)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)data_size);
+    memcpy(buf->Data + offset, data, data_size);
+}
+
+// Serialize all glyphs of all live baked fonts.
+bool ImFontAtlasGlyphCacheSaveToMemory(ImFontAtlas* atlas, ImVector<char>* out_buf)
+{
+    out_buf->resize(0);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* tex = atlas->TexData;
+    if (builder == NULL || tex == NULL || tex->Pixels == NULL)
+        return false;
+
+    ImVector<ImU64> font_keys;
+    font_keys.resize(atlas->Fonts.Size);
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        font_keys[font_n] = ImFontAtlasGlyphCacheGetFontKey(atlas, atlas->Fonts[font_n]);
+
+    ImFontGlyphCacheHeader header;
+    memcpy(header.Magic, "IMGC", 4);
+    header.Version = IMGUI_FONT_GLYPH_CACHE_VERSION;
+    header.ImGuiVersionNum = IMGUI_VERSION_NUM;
+    header.BakedCount = 0;
+    ImFontAtlasGlyphCacheWrite(out_buf, &header, sizeof(header));
+
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked& baked = builder->BakedPool[baked_n];
+        const int font_n = atlas->Fonts.find_index(baked.OwnerFont);
+        if (baked.WantDestroy || font_n == -1 || font_keys[font_n] == 0 || (baked.OwnerFont->Flags & ImFontFlags_DistanceField))
+            continue;
+
+        ImFontGlyphCacheBaked baked_rec;
+        baked_rec.FontKey = font_keys[font_n];
+        baked_rec.Size = baked.Size;
+        baked_rec.RasterizerDensity = baked.RasterizerDensity;
+        baked_rec.GlyphsCount = 0;
+        baked_rec.PixelsSize = 0;
+        const int baked_rec_offset = out_buf->Size;
+        ImFontAtlasGlyphCacheWrite(out_buf, &baked_rec, sizeof(baked_rec));
+
+        // Glyph records then pixels. Codepoint 0 is the synthesized fallback glyph, recreated on demand.
+        ImVector<ImTextureRect> rects;
+        ImVector<ImTextureFormat> rects_fmt;
+        for (const ImFontGlyph& glyph : baked.Glyphs)
+        {
+            if (glyph.Codepoint == 0)
+                continue;
+            ImTextureRect* r = (glyph.PackId != ImFontAtlasRectId_Invalid) ? ImFontAtlasPackGetRectSafe(atlas, glyph.PackId) : NULL;
+            if (glyph.PackId != ImFontAtlasRectId_Invalid && r == NULL)
+                continue;
+            ImFontGlyphCacheGlyph glyph_rec;
+            glyph_rec.Codepoint = glyph.Codepoint;
+            glyph_rec.Width = r ? r->w : 0;
+            glyph_rec.Height = r ? r->h : 0;
+            const ImTextureFormat dst_fmt = glyph.Colored ? tex->Format : ImTextureFormat_Alpha8;
+            glyph_rec.Flags = (glyph.Visible ? 1 : 0) | (glyph.Colored ? 2 : 0) | (dst_fmt == ImTextureFormat_RGBA32 ? 4 : 0) | (glyph.SourceIdx << 8);
+            glyph_rec.AdvanceX = glyph.AdvanceX;
+            glyph_rec.X0 = glyph.X0;
+            glyph_rec.Y0 = glyph.Y0;
+            glyph_rec.X1 = glyph.X1;
+            glyph_rec.Y1 = glyph.Y1;
+            glyph_rec.PixelsOffset = baked_rec.PixelsSize;
+            ImFontAtlasGlyphCacheWrite(out_buf, &glyph_rec, sizeof(glyph_rec));
+            baked_rec.PixelsSize += glyph_rec.Width * glyph_rec.Height * ImTextureDataGetFormatBytesPerPixel(dst_fmt);
+            baked_rec.GlyphsCount++;
+            rects.push_back(r ? *r : ImTextureRect());
+            rects_fmt.push_back(dst_fmt);
+        }
+        for (int rect_n = 0; rect_n < rects.Size; rect_n++)
+        {
+            const ImTextureRect& r = rects[rect_n];
+            const int dst_pitch = r.w * ImTextureDataGetFormatBytesPerPixel(rects_fmt[rect_n]);
+            const int dst_offset = out_buf->Size;
+            out_buf->resize(dst_offset + dst_pitch * r.h);
+            if (r.w > 0 && r.h > 0)
+                ImFontAtlasTextureBlockConvert((const unsigned char*)tex->GetPixelsAt(r.x, r.y), tex->Format, tex->GetPitch(), (unsigned char*)out_buf->Data + dst_offset, rects_fmt[rect_n], dst_pitch, r.w, r.h);
+        }
+
+        memcpy(out_buf->Data + baked_rec_offset, &baked_rec, sizeof(baked_rec));
+        header.BakedCount++;
+    }
+    memcpy(out_buf->Data, &header, sizeof(header));
+    return true;
+}
+
+// Restore glyphs into baked fonts matching current fonts. Glyphs already loaded are left untouched.
+// This doesn't call into the font loader other than for initializing baked fonts.
+int ImFontAtlasGlyphCacheLoadFromMemory(ImFontAtlas* atlas, const void* data, size_t data_size)
+{
+    const char* p = (const char*)data;
+    const char* p_end = p + data_size;
+    ImFontGlyphCacheHeader header;
+    if (data_size < sizeof(header))
+        return -1;
+    memcpy(&header, p, sizeof(header));
+    p += sizeof(header);
+    if (memcmp(header.Magic, "IMGC", 4) != 0 || header.Version != IMGUI_FONT_GLYPH_CACHE_VERSION || header.ImGuiVersionNum != IMGUI_VERSION_NUM)
+        return -1;
+    if (atlas->Locked)
+        return 0;
+
+    ImVector<ImU64> font_keys;
+    font_keys.resize(atlas->Fonts.Size);
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        font_keys[font_n] = ImFontAtlasGlyphCacheGetFontKey(atlas, atlas->Fonts[font_n]);
+
+    int glyphs_loaded = 0;
+    for (ImU32 baked_n = 0; baked_n < header.BakedCount; baked_n++)
+    {
+        ImFontGlyphCacheBaked baked_rec;
+        if ((size_t)(p_end - p) < sizeof(baked_rec))
+            return -1;
+        memcpy(&baked_rec, p, sizeof(baked_rec));
+        p += sizeof(baked_rec);
+        const size_t glyphs_size = (size_t)baked_rec.GlyphsCount * sizeof(ImFontGlyphCacheGlyph);
+        if ((size_t)(p_end - p) < glyphs_size || (size_t)(p_end - p) - glyphs_size < baked_rec.PixelsSize)
+            return -1;
+        const char* glyphs_data = p;
+        const unsigned char* pixels_data = (const unsigned char*)(p + glyphs_size);
+        p += glyphs_size + baked_rec.PixelsSize;
+
+        const int font_n = font_keys.find_index(baked_rec.FontKey);
+        if (font_n == -1)
+            continue;
+        ImFont* font = atlas->Fonts[font_n];
+        if (font->Flags & (ImFontFlags_NoLoadGlyphs | ImFontFlags_DistanceField))
+            continue;
+        if (!(baked_rec.Size > 0.0f && baked_rec.RasterizerDensity > 0.0f))
+            continue;
+        ImFontBaked* baked = ImFontAtlasBakedGetOrAdd(atlas, font, baked_rec.Size, baked_rec.RasterizerDensity);
+        if (baked == NULL || baked->Size != baked_rec.Size || baked->RasterizerDensity != baked_rec.RasterizerDensity)
+            continue; // Closest match returned when sizes are locked
+
+        for (ImU32 glyph_n = 0; glyph_n < baked_rec.GlyphsCount; glyph_n++)
+        {
+            ImFontGlyphCacheGlyph glyph_rec;
+            memcpy(&glyph_rec, glyphs_data + glyph_n * sizeof(glyph_rec), sizeof(glyph_rec));
+            const int src_idx = (glyph_rec.Flags >> 8) & 0x0F;
+            if (glyph_rec.Codepoint == 0 || glyph_rec.Codepoint > IM_UNICODE_CODEPOINT_MAX || src_idx >= font->Sources.Size || baked->IsGlyphLoaded((ImWchar)glyph_rec.Codepoint))
+                continue;
+
+            ImFontGlyph glyph;
+            glyph.Codepoint = glyph_rec.Codepoint;
+            glyph.Visible = (glyph_rec.Flags & 1) != 0;
+            glyph.Colored = (glyph_rec.Flags & 2) != 0;
+            glyph.SourceIdx = src_idx;
+            glyph.AdvanceX = glyph_rec.AdvanceX;
+            glyph.X0 = glyph_rec.X0;
+            glyph.Y0 = glyph_rec.Y0;
+            glyph.X1 = glyph_rec.X1;
+            glyph.Y1 = glyph_rec.Y1;
+            if (glyph_rec.Width > 0 && glyph_rec.Height > 0)
+            {
+                const ImTextureFormat src_fmt = (glyph_rec.Flags & 4) ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+                const int src_bpp = ImTextureDataGetFormatBytesPerPixel(src_fmt);
+                const size_t pixels_size = (size_t)glyph_rec.Width * glyph_rec.Height * src_bpp;
+                if (glyph_rec.PixelsOffset > baked_rec.PixelsSize || baked_rec.PixelsSize - glyph_rec.PixelsOffset < pixels_size)
+                    continue;
+                ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, glyph_rec.Width, glyph_rec.Height);
+                if (pack_id == ImFontAtlasRectId_Invalid)
+                    return glyphs_loaded; // Out of texture space: leave remaining glyphs to the loader
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+                ImTextureData* tex = atlas->TexData; // May have been recreated by packing
+                ImFontAtlasTextureBlockConvert(pixels_data + glyph_rec.PixelsOffset, src_fmt, glyph_rec.Width * src_bpp, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
+                ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
+                glyph.PackId = pack_id;
+            }
+
+            // Stored metrics already include source adjustments (advance clamping, snapping, extra spacing), so don't pass 'src'.
+            ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph);
+            glyphs_loaded++;
+        }
+    }
+    return glyphs_loaded;
+}
+
+bool ImFontAtlas::SaveGlyphCache(const char* filename)
+{
+    ImVector<char> buf;
+    if (!ImFontAtlasGlyphCacheSaveToMemory(this, &buf))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+    const bool ret = ImFileWrite(buf.Data, 1, (ImU64)buf.Size, f) == (ImU64)buf.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool ImFontAtlas::LoadGlyphCache(const char* filename)
+{
+    ImFileMapping mapping;
+    if (!ImFileMap(filename, &mapping))
+        return false;
+    if (Builder == NULL)
+        ImFontAtlasBuildInit(this);
+    const int glyphs_loaded = ImFontAtlasGlyphCacheLoadFromMemory(this, mapping.Data, mapping.Size);
+    ImFileUnmap(&mapping);
+    IMGUI_DEBUG_LOG_FONT("[font] LoadGlyphCache(\"%s\"): %d glyphs\n", filename, glyphs_loaded);
+    return glyphs_loaded >= 0;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas: backend for stb_truetype
 //-------------------------------------------------------------------------
@@ -4590,6 +5761,7 @@ static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig*
         IM_ASSERT_USER_ERROR(0, "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
         return false;
     }
+    bd_font_data->FontInfo.userdata = NULL;
     src->FontLoaderData = bd_font_data;
 
     const float ref_size = src->DstFont->Sources[0]->SizePixels;
@@ -4678,6 +5850,39 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     out_glyph->Codepoint = codepoint;
     out_glyph->AdvanceX = advance * scale_for_layout;
 
+    // Distance field: no oversampling, IMGUI_FONT_DISTANCE_FIELD_SPREAD pixels of padding, edge encoded as 128.
+    if (baked->DistanceField)
+    {
+        const float scale_for_raster = bd_font_data->ScaleFactor * baked->Size * rasterizer_density;
+        const float pixel_dist_scale = 128.0f / IMGUI_FONT_DISTANCE_FIELD_SPREAD;
+        int w = 0, h = 0, xoff = 0, yoff = 0;
+        unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&bd_font_data->FontInfo, scale_for_raster, glyph_index, IMGUI_FONT_DISTANCE_FIELD_SPREAD, 128, pixel_dist_scale, &w, &h, &xoff, &yoff);
+        if (sdf_pixels == NULL)
+            return true; // Blank glyph
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            stbtt_FreeSDF(sdf_pixels, bd_font_data->FontInfo.userdata);
+            return false;
+        }
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+        const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
+        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+        const float font_off_x = src->GlyphOffset.x * offsets_scale;
+        const float font_off_y = src->GlyphOffset.y * offsets_scale + IM_ROUND(baked->Ascent);
+        const float recip = 1.0f / rasterizer_density;
+        out_glyph->X0 = xoff * recip + font_off_x;
+        out_glyph->Y0 = yoff * recip + font_off_y;
+        out_glyph->X1 = (xoff + w) * recip + font_off_x;
+        out_glyph->Y1 = (yoff + h) * recip + font_off_y;
+        out_glyph->Visible = true;
+        out_glyph->PackId = pack_id;
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, sdf_pixels, ImTextureFormat_Alpha8, w);
+        stbtt_FreeSDF(sdf_pixels, bd_font_data->FontInfo.userdata);
+        return true;
+    }
+
     // Pack and retrieve position inside texture atlas
     // (generally based on stbtt_PackFontRangesRenderIntoRects)
     const bool is_visible = (x0 != x1 && y0 != y1);
@@ -4735,6 +5940,211 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     return true;
 }
 
+#ifdef IMGUI_STB_TRUETYPE_USE_SCRATCH_ALLOCATOR
+// Linear allocator for stb_truetype temporary allocations while rasterizing a glyph, reset after each glyph.
+// Fixed block is allocated on calling thread, overflow (unusual) is allocated with the user allocator functions from the worker thread.
+struct ImGui_ImplStbTrueType_Scratch
+{
+    ImVector<char>      Block;
+    size_t              BlockUsed;
+    void*               OverflowHead;   // Linked list of overflow allocations (each starts with a pointer to the next)
+    ImGuiMemAllocFunc   AllocFunc;
+    ImGuiMemFreeFunc    FreeFunc;
+    void*               AllocUserData;
+
+    void Reset()
+    {
+        BlockUsed = 0;
+        while (OverflowHead != NULL)
+        {
+            void* next = *(void**)OverflowHead;
+            FreeFunc(OverflowHead, AllocUserData);
+            OverflowHead = next;
+        }
+    }
+};
+
+static void* ImGui_ImplStbTrueType_ScratchAlloc(size_t size, void* scratch_p)
+{
+    ImGui_ImplStbTrueType_Scratch* scratch = (ImGui_ImplStbTrueType_Scratch*)scratch_p;
+    const size_t ALIGN = 16;
+    size = (size + ALIGN - 1) & ~(ALIGN - 1);
+    if (scratch->BlockUsed + size <= (size_t)scratch->Block.Size)
+    {
+        void* p = scratch->Block.Data + scratch->BlockUsed;
+        scratch->BlockUsed += size;
+        return p;
+    }
+    void* p = scratch->AllocFunc(ALIGN + size, scratch->AllocUserData);
+    if (p == NULL)
+        return NULL;
+    *(void**)p = scratch->OverflowHead;
+    scratch->OverflowHead = p;
+    return (char*)p + ALIGN;
+}
+
+struct ImGui_ImplStbTrueType_GlyphJob
+{
+    int     GlyphIndex;
+    int     OutIndex;       // Index into out_glyphs[]
+    int     W, H;           // Bitmap size (including oversampling padding)
+    int     PixelsOffset;   // Offset into ImGui_ImplStbTrueType_BatchData::Pixels
+    float   SubX, SubY;     // Output of stbtt_MakeGlyphBitmapSubpixelPrefilter()
+};
+
+struct ImGui_ImplStbTrueType_BatchData
+{
+    const stbtt_fontinfo*   FontInfo;
+    float                   ScaleX, ScaleY;
+    int                     OversampleH, OversampleV;
+    int                     JobsCount;
+    ImGui_ImplStbTrueType_GlyphJob* Glyphs;
+    int                     GlyphsCount;
+    unsigned char*          Pixels;
+    ImGui_ImplStbTrueType_Scratch* Scratches;
+};
+
+// Job n rasterizes glyphs n, n + JobsCount, n + JobsCount*2 etc. Only touches its own pixels and scratch allocator.
+static void ImGui_ImplStbTrueType_RasterizeGlyphsJob(void* job_data, int job_n)
+{
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Fonts"); // May run on a worker thread, which has its own tag stack
+    ImGui_ImplStbTrueType_BatchData* batch = (ImGui_ImplStbTrueType_BatchData*)job_data;
+    stbtt_fontinfo font_info = *batch->FontInfo;
+    font_info.userdata = &batch->Scratches[job_n];
+    for (int n = job_n; n < batch->GlyphsCount; n += batch->JobsCount)
+    {
+        ImGui_ImplStbTrueType_GlyphJob* job = &batch->Glyphs[n];
+        stbtt_MakeGlyphBitmapSubpixelPrefilter(&font_info, batch->Pixels + job->PixelsOffset, job->W, job->H, job->W,
+            batch->ScaleX, batch->ScaleY, 0, 0, batch->OversampleH, batch->OversampleV, &job->SubX, &job->SubY, job->GlyphIndex);
+        batch->Scratches[job_n].Reset();
+    }
+}
+
+// Same as calling ImGui_ImplStbTrueType_FontBakedLoadGlyph() for each codepoint, but rasterization is done by atlas->ParallelForFunc.
+// Metrics, packing and texture upload are done on calling thread.
+static void ImGui_ImplStbTrueType_FontBakedLoadGlyphs(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, const ImWchar* codepoints, int codepoints_count, ImFontGlyph* out_glyphs, bool* out_found)
+{
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+    IM_ASSERT(bd_font_data);
+
+    // Fonts unit to pixels
+    int oversample_h, oversample_v;
+    ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+    const float scale_for_layout = bd_font_data->ScaleFactor * baked->Size;
+    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+    const float scale_for_raster_x = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_h;
+    const float scale_for_raster_y = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_v;
+
+    // Obtain size and advance, allocate bitmaps
+    ImVector<ImGui_ImplStbTrueType_GlyphJob> jobs;
+    int pixels_size = 0;
+    for (int n = 0; n < codepoints_count; n++)
+    {
+        ImFontGlyph* out_glyph = &out_glyphs[n];
+        const int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoints[n]);
+        out_found[n] = (glyph_index != 0);
+        if (glyph_index == 0)
+            continue;
+
+        int x0, y0, x1, y1;
+        int advance, lsb;
+        stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
+        stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
+        *out_glyph = ImFontGlyph();
+        out_glyph->Codepoint = codepoints[n];
+        out_glyph->AdvanceX = advance * scale_for_layout;
+        if (x0 == x1 || y0 == y1)
+            continue;
+
+        ImGui_ImplStbTrueType_GlyphJob job;
+        job.GlyphIndex = glyph_index;
+        job.OutIndex = n;
+        job.W = (x1 - x0 + oversample_h - 1);
+        job.H = (y1 - y0 + oversample_v - 1);
+        job.PixelsOffset = pixels_size;
+        job.SubX = job.SubY = 0.0f;
+        pixels_size += job.W * job.H;
+        jobs.push_back(job);
+    }
+    if (jobs.Size == 0)
+        return;
+
+    // Rasterize in parallel (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->TempBuffer.resize(pixels_size);
+    memset(builder->TempBuffer.Data, 0, (size_t)pixels_size);
+    const int jobs_count = ImClamp(ImMin(atlas->ParallelForJobsMax, jobs.Size), 1, 64);
+    ImGui_ImplStbTrueType_Scratch scratches[64];
+    ImGuiMemAllocFunc alloc_func;
+    ImGuiMemFreeFunc free_func;
+    void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    for (int job_n = 0; job_n < jobs_count; job_n++)
+    {
+        ImGui_ImplStbTrueType_Scratch* scratch = &scratches[job_n];
+        scratch->Block.resize(64 * 1024); // Enough for all but pathological glyphs
+        scratch->BlockUsed = 0;
+        scratch->OverflowHead = NULL;
+        scratch->AllocFunc = alloc_func;
+        scratch->FreeFunc = free_func;
+        scratch->AllocUserData = alloc_user_data;
+    }
+    ImGui_ImplStbTrueType_BatchData batch;
+    batch.FontInfo = &bd_font_data->FontInfo;
+    batch.ScaleX = scale_for_raster_x;
+    batch.ScaleY = scale_for_raster_y;
+    batch.OversampleH = oversample_h;
+    batch.OversampleV = oversample_v;
+    batch.JobsCount = jobs_count;
+    batch.Glyphs = jobs.Data;
+    batch.GlyphsCount = jobs.Size;
+    batch.Pixels = builder->TempBuffer.Data;
+    batch.Scratches = scratches;
+    if (jobs_count > 1 && atlas->ParallelForFunc != NULL)
+        atlas->ParallelForFunc(atlas->ParallelForUserData, jobs_count, ImGui_ImplStbTrueType_RasterizeGlyphsJob, &batch);
+    else
+        for (int job_n = 0; job_n < jobs_count; job_n++)
+            ImGui_ImplStbTrueType_RasterizeGlyphsJob(&batch, job_n);
+
+    // Pack, register and upload
+    const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    float font_off_x_base = (src->GlyphOffset.x * offsets_scale);
+    float font_off_y_base = (src->GlyphOffset.y * offsets_scale);
+    if (src->PixelSnapH)
+        font_off_x_base = IM_ROUND(font_off_x_base);
+    if (src->PixelSnapV)
+        font_off_y_base = IM_ROUND(font_off_y_base);
+    const float recip_h = 1.0f / (oversample_h * rasterizer_density);
+    const float recip_v = 1.0f / (oversample_v * rasterizer_density);
+    for (const ImGui_ImplStbTrueType_GlyphJob& job : jobs)
+    {
+        ImFontGlyph* out_glyph = &out_glyphs[job.OutIndex];
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, job.W, job.H);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            out_found[job.OutIndex] = false;
+            continue;
+        }
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+
+        int x0, y0, x1, y1;
+        stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, job.GlyphIndex, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
+        const float font_off_x = font_off_x_base + job.SubX;
+        const float font_off_y = font_off_y_base + job.SubY + IM_ROUND(baked->Ascent);
+        out_glyph->X0 = x0 * recip_h + font_off_x;
+        out_glyph->Y0 = y0 * recip_v + font_off_y;
+        out_glyph->X1 = (x0 + (int)r->w) * recip_h + font_off_x;
+        out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
+        out_glyph->Visible = true;
+        out_glyph->PackId = pack_id;
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, builder->TempBuffer.Data + job.PixelsOffset, ImTextureFormat_Alpha8, job.W);
+    }
+}
+#endif // IMGUI_STB_TRUETYPE_USE_SCRATCH_ALLOCATOR
+
 const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
 {
     static ImFontLoader loader;
@@ -4745,6 +6155,9 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+#ifdef IMGUI_STB_TRUETYPE_USE_SCRATCH_ALLOCATOR
+    loader.FontBakedLoadGlyphs = ImGui_ImplStbTrueType_FontBakedLoadGlyphs;
+#endif
     return &loader;
 }
 
@@ -5084,6 +6497,7 @@ void ImFontBaked::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPageMap.clear();
     FallbackGlyphIndex = -1;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -5143,6 +6557,11 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->V0 = (r->y) * atlas->TexUvScale.y;
         glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
         glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
+        if (baked->DistanceField)
+        {
+            glyph->U0 += IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET;
+            glyph->U1 += IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET;
+        }
         baked->MetricsTotalSurface += r->w * r->h;
     }
 
@@ -5171,9 +6590,9 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = glyph->AdvanceX;
-    baked->IndexLookup[codepoint] = (ImU16)glyph_idx;
+    const int slot = ImFontBaked_BuildGetOrAddIndexSlot(baked, codepoint);
+    baked->IndexAdvanceX[slot] = glyph->AdvanceX;
+    baked->IndexLookup[slot] = (ImU16)glyph_idx;
     const int page_n = codepoint / 8192;
     baked->OwnerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
@@ -5199,8 +6618,8 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
         advance_x += src->GlyphExtraAdvanceX;
     }
 
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = advance_x;
+    const int slot = ImFontBaked_BuildGetOrAddIndexSlot(baked, codepoint);
+    baked->IndexAdvanceX[slot] = advance_x;
 }
 
 // Copy to texture, post-process and queue update for backend
@@ -5209,8 +6628,11 @@ void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked,
     ImTextureData* tex = atlas->TexData;
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
-    ImFontAtlasPostProcessData pp_data = { atlas, baked->OwnerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
-    ImFontAtlasTextureBlockPostProcess(&pp_data);
+    if (!baked->DistanceField) // Post-processing operates on coverage, not distances
+    {
+        ImFontAtlasPostProcessData pp_data = { atlas, baked->OwnerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
+        ImFontAtlasTextureBlockPostProcess(&pp_data);
+    }
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 }
 
@@ -5222,9 +6644,10 @@ void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 // Find glyph, load if necessary, return fallback if missing
 ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const unsigned int slot = ImFontBaked_GetIndexSlot(this, c);
+    if (slot < (unsigned int)IndexLookup.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexLookup.Data[slot];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return &Glyphs.Data[FallbackGlyphIndex];
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5237,9 +6660,10 @@ ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 // Attempt to load but when missing, return NULL instead of FallbackGlyph
 ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const unsigned int slot = ImFontBaked_GetIndexSlot(this, c);
+    if (slot < (unsigned int)IndexLookup.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexLookup.Data[slot];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return NULL;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5253,9 +6677,10 @@ ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 
 bool ImFontBaked::IsGlyphLoaded(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const unsigned int slot = ImFontBaked_GetIndexSlot(this, c);
+    if (slot < (unsigned int)IndexLookup.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexLookup.Data[slot];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return false;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5282,10 +6707,11 @@ bool ImFont::IsGlyphInFont(ImWchar c)
 IM_MSVC_RUNTIME_CHECKS_OFF
 float ImFontBaked::GetCharAdvance(ImWchar c)
 {
-    if ((int)c < IndexAdvanceX.Size)
+    const unsigned int slot = ImFontBaked_GetIndexSlot(this, c);
+    if (slot < (unsigned int)IndexAdvanceX.Size)
     {
         // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
-        const float x = IndexAdvanceX.Data[c];
+        const float x = IndexAdvanceX.Data[slot];
         if (x >= 0.0f)
             return x;
     }
@@ -5318,6 +6744,19 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
 
     ImFontAtlas* atlas = OwnerAtlas;
     ImFontAtlasBuilder* builder = atlas->Builder;
+
+    // Distance field fonts: a single baked font serves all sizes, scaled by callers using baked->Size.
+    if ((Flags & ImFontFlags_DistanceField) && atlas->RendererHasDistanceFields)
+    {
+        if (baked == NULL || !baked->DistanceField)
+            baked = ImFontAtlasBakedGetOrAddDistanceField(atlas, this);
+        if (baked == NULL)
+            return NULL;
+        baked->LastUsedFrame = builder->FrameCount;
+        LastBaked = baked;
+        return baked;
+    }
+
     baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
     if (baked == NULL)
         return NULL;
@@ -5357,7 +6796,28 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
 
     // Create new
     baked = ImFontAtlasBakedAdd(atlas, font, font_size, font_rasterizer_density, baked_id);
-    *p_baked_in_map = baked; // To avoid 'builder->BakedMap.SetVoidPtr(baked_id, baked);' while we can.
+    if (font->Flags & ImFontFlags_DistanceField)
+        builder->BakedMap.SetVoidPtr(baked_id, baked); // Creating our first glyphs may have added the distance field baked font to BakedMap, invalidating 'p_baked_in_map'.
+    else
+        *p_baked_in_map = baked; // To avoid 'builder->BakedMap.SetVoidPtr(baked_id, baked);' while we can.
+    return baked;
+}
+
+// Distance field fonts (ImFontFlags_DistanceField) have a single baked font at IMGUI_FONT_DISTANCE_FIELD_SIZE holding distance fields.
+// It is used directly when renderer supports distance fields, otherwise it is the source regular baked fonts are resampled from.
+ImFontBaked* ImFontAtlasBakedGetOrAddDistanceField(ImFontAtlas* atlas, ImFont* font)
+{
+    IM_ASSERT(font->Flags & ImFontFlags_DistanceField);
+    const float font_size = IMGUI_FONT_DISTANCE_FIELD_SIZE;
+    ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, font_size, 0.0f); // Density 0.0f is never used by regular baked fonts
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(baked_id);
+    if (baked != NULL)
+        return baked;
+    if (atlas->Locked)
+        return NULL;
+    baked = ImFontAtlasBakedAdd(atlas, font, font_size, 1.0f, baked_id, true);
+    builder->BakedMap.SetVoidPtr(baked_id, baked);
     return baked;
 }
 
@@ -5424,7 +6884,8 @@ const char* ImFontCalcWordWrapPositionEx(ImFont* font, float size, const char* t
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        const unsigned int slot = ImFontBaked_GetIndexSlot(baked, c);
+        float char_width = (slot < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[slot] : -1.0f;
         if (char_width < 0.0f)
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
 
@@ -5545,9 +7006,10 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
             continue;
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        const unsigned int slot = ImFontBaked_GetIndexSlot(baked, c);
+        float char_width = (slot < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[slot] : -1.0f;
         if (char_width < 0.0f)
-            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            char_width = BuildLoadGlyphsGetAdvanceOrFallback(baked, c, prev_s, text_end_display);
         char_width *= scale;
 
         if (line_width + char_width >= max_width)
@@ -5690,6 +7152,7 @@ begin:
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const bool ascii_fast_path = !cpu_fine_clip && baked->IndexLookup.Size >= IM_FONTGLYPH_INDEX_PAGE_SIZE; // Not with password font (empty IndexLookup[])
 
     while (s < text_end)
     {
@@ -5711,6 +7174,42 @@ begin:
             }
         }
 
+        // Fast path for runs of printable ASCII: no UTF-8 decoding, glyphs looked up directly from first page of IndexLookup[] (codepoints 0..255 are at their own index).
+        // Runs stop at control characters, multi-byte sequences and word-wrap position, which are handled by the general path below.
+        if (ascii_fast_path && (unsigned char)(*s - ' ') < 0x60)
+        {
+            const char* run_end = ImTextSkipPrintableAscii(s, (word_wrap_eol != NULL) ? word_wrap_eol : text_end);
+            for (; s < run_end; s++)
+            {
+                const unsigned int c = (unsigned char)*s;
+                const unsigned int i = baked->IndexLookup.Data[c]; // Don't cache pointer: loading a glyph may grow IndexLookup[]
+                const ImFontGlyph* glyph = (i < IM_FONTGLYPH_INDEX_NOT_FOUND) ? &baked->Glyphs.Data[i] : baked->FindGlyph((ImWchar)c);
+                if (glyph->Visible)
+                {
+                    const float x1 = x + glyph->X0 * scale;
+                    const float x2 = x + glyph->X1 * scale;
+                    if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+                    {
+                        const float y1 = y + glyph->Y0 * scale;
+                        const float y2 = y + glyph->Y1 * scale;
+                        const float u1 = glyph->U0, v1 = glyph->V0, u2 = glyph->U1, v2 = glyph->V1;
+                        const ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+                        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+                        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+                        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+                        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                        vtx_write += 4;
+                        vtx_index += 4;
+                        idx_write += 6;
+                    }
+                }
+                x += glyph->AdvanceX * scale;
+            }
+            continue;
+        }
+
         // Decode and advance source
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
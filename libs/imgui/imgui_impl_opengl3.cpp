@@ -7,6 +7,7 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [x] Renderer: Distance field fonts rendered at any size from a single baked font (ImGuiBackendFlags_RendererHasDistanceFields) [Not on ES 2.0/WebGL 1.0]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +24,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Added support for ImGuiBackendFlags_RendererHasDistanceFields: fragment shaders threshold distance field glyphs (tagged with IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET, in managed textures only) using fwidth().
+//  2026-10-18: OpenGL: Added optional partial redraw restricted to ImDrawData::DamageRects[] with ImGui_ImplOpenGL3_SetPartialRedraw().
+//  2026-10-18: OpenGL: Added optional compact vertex layout (ImDrawVertCompact) with ImGui_ImplOpenGL3_SetCompactVertices().
+//  2026-10-18: OpenGL: Added shadow-state cache skipping redundant texture/scissor/blend/program/VAO calls in the render loop. Added ImGui_ImplOpenGL3_GetRenderStats().
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
 //  2025-07-15: OpenGL: Set GL_UNPACK_ALIGNMENT to 1 before updating textures (#8802) + restore non-WebGL/ES update path that doesn't require a CPU-side copy.
@@ -227,6 +232,38 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+// Shadow copy of the GL state touched by ImGui_ImplOpenGL3_RenderDrawData(), used to skip redundant state changes.
+// Seeded from the state backup at the start of each render call. Invalidated around user callbacks, which may touch anything.
+enum ImGui_ImplOpenGL3_StateBit_
+{
+    ImGui_ImplOpenGL3_StateBit_Program          = 1 << 0,
+    ImGui_ImplOpenGL3_StateBit_Texture          = 1 << 1,
+    ImGui_ImplOpenGL3_StateBit_VertexArray      = 1 << 2,
+    ImGui_ImplOpenGL3_StateBit_Scissor          = 1 << 3,
+    ImGui_ImplOpenGL3_StateBit_BlendEquation    = 1 << 4,
+    ImGui_ImplOpenGL3_StateBit_BlendFunc        = 1 << 5,
+    ImGui_ImplOpenGL3_StateBit_EnableBlend      = 1 << 6,
+    ImGui_ImplOpenGL3_StateBit_EnableCullFace   = 1 << 7,
+    ImGui_ImplOpenGL3_StateBit_EnableDepthTest  = 1 << 8,
+    ImGui_ImplOpenGL3_StateBit_EnableStencilTest= 1 << 9,
+    ImGui_ImplOpenGL3_StateBit_EnableScissorTest= 1 << 10,
+    ImGui_ImplOpenGL3_StateBit_All              = (1 << 11) - 1,   // All state saved by the backup
+    ImGui_ImplOpenGL3_StateBit_DistanceField    = 1 << 11,          // Our own 'EnableDistanceField' uniform
+};
+
+struct ImGui_ImplOpenGL3_StateCache
+{
+    int             ValidMask;              // Combination of ImGui_ImplOpenGL3_StateBit_, fields without their bit set are unknown.
+    GLuint          Program;
+    GLuint          Texture;
+    GLuint          VertexArray;
+    GLint           ScissorBox[4];
+    GLenum          BlendEquationRgb, BlendEquationAlpha;
+    GLenum          BlendSrcRgb, BlendDstRgb, BlendSrcAlpha, BlendDstAlpha;
+    GLboolean       EnableBlend, EnableCullFace, EnableDepthTest, EnableStencilTest, EnableScissorTest;
+    bool            EnableDistanceField;
+};
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -240,6 +277,7 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationEnableDistanceField;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -251,6 +289,15 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasClipOrigin;
     bool            UseBufferSubData;
     ImVector<char>  TempBuffer;
+    ImGui_ImplOpenGL3_StateCache StateCache;
+    bool            UseCompactVertices;      // Set by ImGui_ImplOpenGL3_SetCompactVertices()
+    bool            VtxFormatCompact;        // Vertex attributes currently setup for ImDrawVertCompact
+    float           ProjMtx[4][4];           // Projection matrix for ImDrawVert positions, as setup by ImGui_ImplOpenGL3_SetupRenderState()
+    ImVector<ImDrawVertCompact> CompactVtxBuffer;
+    bool            UsePartialRedraw;        // Set by ImGui_ImplOpenGL3_SetPartialRedraw()
+    bool            PartialRedrawClear;
+    float           PartialRedrawClearColor[4];
+    ImGui_ImplOpenGL3_RenderStats Stats;     // Statistics for the last ImGui_ImplOpenGL3_RenderDrawData() call
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -368,6 +415,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;       // We can honor ImGuiPlatformIO::Textures[] requests during render.
+#ifndef IMGUI_IMPL_OPENGL_ES2
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasDistanceFields; // We can render ImFontFlags_DistanceField glyphs directly (fragment shader needs fwidth(), not available in GLSL ES 1.00 without extension).
+#endif
 
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
     platform_io.Renderer_TextureMaxWidth = platform_io.Renderer_TextureMaxHeight = (int)bd->MaxTextureSize;
@@ -428,7 +478,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasDistanceFields);
     platform_io.ClearRendererHandlers();
     IM_DELETE(bd);
 
@@ -449,18 +499,107 @@ void    ImGui_ImplOpenGL3_NewFrame()
             IM_ASSERT(0 && "ImGui_ImplOpenGL3_CreateDeviceObjects() failed!");
 }
 
+// Shadow-state helpers: return true (and count a skip) when the cached value already matches.
+static bool ImGui_ImplOpenGL3_StateCacheSkip(ImGui_ImplOpenGL3_Data* bd, int state_bit, bool matches)
+{
+    if ((bd->StateCache.ValidMask & state_bit) && matches)
+    {
+        bd->Stats.StateCallsSkipped++;
+        return true;
+    }
+    bd->StateCache.ValidMask |= state_bit;
+    bd->Stats.StateCallsSubmitted++;
+    return false;
+}
+
+static void ImGui_ImplOpenGL3_SetEnabled(ImGui_ImplOpenGL3_Data* bd, GLenum cap, int state_bit, GLboolean* cached, GLboolean enable)
+{
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, state_bit, *cached == enable))
+        return;
+    *cached = enable;
+    if (enable) glEnable(cap); else glDisable(cap);
+}
+
+static void ImGui_ImplOpenGL3_UseProgram(ImGui_ImplOpenGL3_Data* bd, GLuint program)
+{
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, ImGui_ImplOpenGL3_StateBit_Program, bd->StateCache.Program == program))
+        return;
+    bd->StateCache.Program = program;
+    GL_CALL(glUseProgram(program));
+}
+
+static void ImGui_ImplOpenGL3_BindTexture(ImGui_ImplOpenGL3_Data* bd, GLuint texture)
+{
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, ImGui_ImplOpenGL3_StateBit_Texture, bd->StateCache.Texture == texture))
+        return;
+    bd->StateCache.Texture = texture;
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+}
+
+// Distance field glyphs are only ever found in textures managed by dear imgui (font atlases): don't apply the U offset test to user textures, which may use any UV.
+static void ImGui_ImplOpenGL3_SetEnableDistanceField(ImGui_ImplOpenGL3_Data* bd, bool enable)
+{
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, ImGui_ImplOpenGL3_StateBit_DistanceField, bd->StateCache.EnableDistanceField == enable))
+        return;
+    bd->StateCache.EnableDistanceField = enable;
+    GL_CALL(glUniform1i(bd->AttribLocationEnableDistanceField, enable ? 1 : 0));
+}
+
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+static void ImGui_ImplOpenGL3_BindVertexArray(ImGui_ImplOpenGL3_Data* bd, GLuint vertex_array_object)
+{
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, ImGui_ImplOpenGL3_StateBit_VertexArray, bd->StateCache.VertexArray == vertex_array_object))
+        return;
+    bd->StateCache.VertexArray = vertex_array_object;
+    GL_CALL(glBindVertexArray(vertex_array_object));
+}
+#endif
+
+static void ImGui_ImplOpenGL3_SetScissor(ImGui_ImplOpenGL3_Data* bd, GLint x, GLint y, GLint w, GLint h)
+{
+    GLint* box = bd->StateCache.ScissorBox;
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, ImGui_ImplOpenGL3_StateBit_Scissor, box[0] == x && box[1] == y && box[2] == w && box[3] == h))
+        return;
+    box[0] = x; box[1] = y; box[2] = w; box[3] = h;
+    GL_CALL(glScissor(x, y, (GLsizei)w, (GLsizei)h));
+}
+
+static void ImGui_ImplOpenGL3_SetBlendEquation(ImGui_ImplOpenGL3_Data* bd, GLenum mode_rgb, GLenum mode_alpha)
+{
+    ImGui_ImplOpenGL3_StateCache& sc = bd->StateCache;
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, ImGui_ImplOpenGL3_StateBit_BlendEquation, sc.BlendEquationRgb == mode_rgb && sc.BlendEquationAlpha == mode_alpha))
+        return;
+    sc.BlendEquationRgb = mode_rgb;
+    sc.BlendEquationAlpha = mode_alpha;
+    GL_CALL(glBlendEquationSeparate(mode_rgb, mode_alpha));
+}
+
+static void ImGui_ImplOpenGL3_SetBlendFunc(ImGui_ImplOpenGL3_Data* bd, GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+    ImGui_ImplOpenGL3_StateCache& sc = bd->StateCache;
+    if (ImGui_ImplOpenGL3_StateCacheSkip(bd, ImGui_ImplOpenGL3_StateBit_BlendFunc, sc.BlendSrcRgb == src_rgb && sc.BlendDstRgb == dst_rgb && sc.BlendSrcAlpha == src_alpha && sc.BlendDstAlpha == dst_alpha))
+        return;
+    sc.BlendSrcRgb = src_rgb;
+    sc.BlendDstRgb = dst_rgb;
+    sc.BlendSrcAlpha = src_alpha;
+    sc.BlendDstAlpha = dst_alpha;
+    GL_CALL(glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha));
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
-    glEnable(GL_BLEND);
-    glBlendEquation(GL_FUNC_ADD);
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
-    glDisable(GL_CULL_FACE);
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_STENCIL_TEST);
-    glEnable(GL_SCISSOR_TEST);
+    // (Goes through the shadow-state cache: states already matching what the application left bound are not re-submitted)
+    ImGui_ImplOpenGL3_StateCache& sc = bd->StateCache;
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_BLEND, ImGui_ImplOpenGL3_StateBit_EnableBlend, &sc.EnableBlend, GL_TRUE);
+    ImGui_ImplOpenGL3_SetBlendEquation(bd, GL_FUNC_ADD, GL_FUNC_ADD);
+    ImGui_ImplOpenGL3_SetBlendFunc(bd, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_CULL_FACE, ImGui_ImplOpenGL3_StateBit_EnableCullFace, &sc.EnableCullFace, GL_FALSE);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_DEPTH_TEST, ImGui_ImplOpenGL3_StateBit_EnableDepthTest, &sc.EnableDepthTest, GL_FALSE);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_STENCIL_TEST, ImGui_ImplOpenGL3_StateBit_EnableStencilTest, &sc.EnableStencilTest, GL_FALSE);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_SCISSOR_TEST, ImGui_ImplOpenGL3_StateBit_EnableScissorTest, &sc.EnableScissorTest, GL_TRUE);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     if (!bd->GlProfileIsES3 && bd->GlVersion >= 310)
         glDisable(GL_PRIMITIVE_RESTART);
@@ -498,7 +637,8 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
-    glUseProgram(bd->ShaderHandle);
+    memcpy(bd->ProjMtx, ortho_projection, sizeof(ortho_projection));
+    ImGui_ImplOpenGL3_UseProgram(bd, bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
 
@@ -509,7 +649,7 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 
     (void)vertex_array_object;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindVertexArray(vertex_array_object);
+    ImGui_ImplOpenGL3_BindVertexArray(bd, vertex_array_object);
 #endif
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
@@ -521,6 +661,42 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
+    bd->VtxFormatCompact = false;
+}
+
+// Switch vertex attributes and projection between the ImDrawVert and ImDrawVertCompact layouts.
+// Compact positions are fixed-point values relative to 'origin': the conversion back to pixels is folded into the projection matrix.
+static void ImGui_ImplOpenGL3_SetupVertexFormat(ImGui_ImplOpenGL3_Data* bd, bool compact, const ImVec2& origin)
+{
+    if (!compact && !bd->VtxFormatCompact)
+        return;
+    if (compact != bd->VtxFormatCompact)
+    {
+        if (compact)
+        {
+            GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(ImDrawVertCompact), (GLvoid*)offsetof(ImDrawVertCompact, pos)));
+            GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVertCompact), (GLvoid*)offsetof(ImDrawVertCompact, uv)));
+            GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE,  GL_TRUE,  sizeof(ImDrawVertCompact), (GLvoid*)offsetof(ImDrawVertCompact, col)));
+        }
+        else
+        {
+            GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+            GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+            GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
+        }
+        bd->VtxFormatCompact = compact;
+    }
+    float mtx[4][4];
+    memcpy(mtx, bd->ProjMtx, sizeof(mtx));
+    if (compact)
+    {
+        const float scale = 1.0f / IM_DRAWVERT_COMPACT_POS_SCALE;
+        mtx[3][0] += mtx[0][0] * origin.x;
+        mtx[3][1] += mtx[1][1] * origin.y;
+        mtx[0][0] *= scale;
+        mtx[1][1] *= scale;
+    }
+    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &mtx[0][0]);
 }
 
 // OpenGL3 Render function.
@@ -537,6 +713,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImGui_ImplOpenGL3_InitLoader(); // Lazily init loader if not already done for e.g. DLL boundaries.
 
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    memset(&bd->Stats, 0, sizeof(bd->Stats));
 
     // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
     // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
@@ -545,6 +722,30 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             if (tex->Status != ImTextureStatus_OK)
                 ImGui_ImplOpenGL3_UpdateTexture(tex);
 
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // With ImGui_ImplOpenGL3_SetPartialRedraw(true), restrict clearing and drawing to the union of damaged areas.
+    // Everything outside of it is left untouched in the framebuffer, which needs to still contain the previous frame.
+    ImVec2 damage_min(0.0f, 0.0f);
+    ImVec2 damage_max((float)fb_width, (float)fb_height);
+    if (bd->UsePartialRedraw)
+    {
+        if (draw_data->DamageRects.Size == 0)
+            return;
+        ImVec4 damage = draw_data->DamageRects[0];
+        for (const ImVec4& r : draw_data->DamageRects)
+            damage = ImVec4(r.x < damage.x ? r.x : damage.x, r.y < damage.y ? r.y : damage.y, r.z > damage.z ? r.z : damage.z, r.w > damage.w ? r.w : damage.w);
+        damage_min = ImVec2((damage.x - clip_off.x) * clip_scale.x, (damage.y - clip_off.y) * clip_scale.y);
+        damage_max = ImVec2((damage.z - clip_off.x) * clip_scale.x, (damage.w - clip_off.y) * clip_scale.y);
+        damage_min = ImVec2(damage_min.x > 0.0f ? (float)(int)damage_min.x : 0.0f, damage_min.y > 0.0f ? (float)(int)damage_min.y : 0.0f); // Round outward: anti-aliased edges may touch partial pixels
+        damage_max = ImVec2(damage_max.x < (float)fb_width ? (float)(int)(damage_max.x + 1.0f) : (float)fb_width, damage_max.y < (float)fb_height ? (float)(int)(damage_max.y + 1.0f) : (float)fb_height);
+        if (damage_max.x <= damage_min.x || damage_max.y <= damage_min.y)
+            return;
+    }
+    bd->Stats.PixelsDrawn = (int)((damage_max.x - damage_min.x) * (damage_max.y - damage_min.y));
+
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
     glActiveTexture(GL_TEXTURE0);
@@ -584,6 +785,29 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLboolean last_enable_primitive_restart = (!bd->GlProfileIsES3 && bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
 
+    // Seed shadow-state cache from the backup, so we know exactly what is currently bound
+    ImGui_ImplOpenGL3_StateCache& sc = bd->StateCache;
+    sc.ValidMask = ImGui_ImplOpenGL3_StateBit_All;
+    sc.Program = last_program;
+    sc.Texture = last_texture;
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    sc.VertexArray = last_vertex_array_object;
+#else
+    sc.ValidMask &= ~ImGui_ImplOpenGL3_StateBit_VertexArray;
+#endif
+    memcpy(sc.ScissorBox, last_scissor_box, sizeof(sc.ScissorBox));
+    sc.BlendEquationRgb = last_blend_equation_rgb;
+    sc.BlendEquationAlpha = last_blend_equation_alpha;
+    sc.BlendSrcRgb = last_blend_src_rgb;
+    sc.BlendDstRgb = last_blend_dst_rgb;
+    sc.BlendSrcAlpha = last_blend_src_alpha;
+    sc.BlendDstAlpha = last_blend_dst_alpha;
+    sc.EnableBlend = last_enable_blend;
+    sc.EnableCullFace = last_enable_cull_face;
+    sc.EnableDepthTest = last_enable_depth_test;
+    sc.EnableStencilTest = last_enable_stencil_test;
+    sc.EnableScissorTest = last_enable_scissor_test;
+
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
@@ -593,9 +817,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
-    // Will project scissor/clipping rectangles into framebuffer space
-    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
-    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+    // Clear damaged area (scissor test is enabled by ImGui_ImplOpenGL3_SetupRenderState(). Clear color is not restored)
+    if (bd->UsePartialRedraw && bd->PartialRedrawClear)
+    {
+        ImGui_ImplOpenGL3_SetScissor(bd, (int)damage_min.x, (int)((float)fb_height - damage_max.y), (int)(damage_max.x - damage_min.x), (int)(damage_max.y - damage_min.y));
+        GL_CALL(glClearColor(bd->PartialRedrawClearColor[0], bd->PartialRedrawClearColor[1], bd->PartialRedrawClearColor[2], bd->PartialRedrawClearColor[3]));
+        GL_CALL(glClear(GL_COLOR_BUFFER_BIT));
+    }
 
     // Render command lists
     for (const ImDrawList* draw_list : draw_data->CmdLists)
@@ -608,8 +836,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
         //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
-        const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+        // - With ImGui_ImplOpenGL3_SetCompactVertices(true), lists which can be represented are converted to ImDrawVertCompact (12 bytes instead of 20) before upload.
+        ImVec2 vtx_compact_origin;
+        const bool vtx_compact = bd->UseCompactVertices && draw_list->BuildCompactVtxBuffer(&bd->CompactVtxBuffer, &vtx_compact_origin);
+        const GLvoid* vtx_buffer_data = vtx_compact ? (const GLvoid*)bd->CompactVtxBuffer.Data : (const GLvoid*)draw_list->VtxBuffer.Data;
+        const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)(vtx_compact ? sizeof(ImDrawVertCompact) : sizeof(ImDrawVert));
         const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+        bd->Stats.VtxBytesUploaded += (int)vtx_buffer_size;
         if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
@@ -622,14 +855,15 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 bd->IndexBufferSize = idx_buffer_size;
                 GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
             }
-            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data));
+            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, vtx_buffer_data));
             GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data));
         }
         else
         {
-            GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, vtx_buffer_data, GL_STREAM_DRAW));
             GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data, GL_STREAM_DRAW));
         }
+        ImGui_ImplOpenGL3_SetupVertexFormat(bd, vtx_compact, vtx_compact_origin);
 
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
@@ -638,24 +872,33 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                // (User code may modify any GL state behind our back, so the shadow-state cache is invalidated first)
+                bd->StateCache.ValidMask = 0;
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    ImGui_ImplOpenGL3_SetupVertexFormat(bd, vtx_compact, vtx_compact_origin);
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
             }
             else
             {
-                // Project scissor/clipping rectangles into framebuffer space
+                // Project scissor/clipping rectangles into framebuffer space, intersect with damaged area (whole framebuffer unless using partial redraw)
                 ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
                 ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+                clip_min = ImVec2(clip_min.x > damage_min.x ? clip_min.x : damage_min.x, clip_min.y > damage_min.y ? clip_min.y : damage_min.y);
+                clip_max = ImVec2(clip_max.x < damage_max.x ? clip_max.x : damage_max.x, clip_max.y < damage_max.y ? clip_max.y : damage_max.y);
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+                ImGui_ImplOpenGL3_SetScissor(bd, (int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
 
                 // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                ImGui_ImplOpenGL3_BindTexture(bd, (GLuint)(intptr_t)pcmd->GetTexID());
+                ImGui_ImplOpenGL3_SetEnableDistanceField(bd, pcmd->TexRef._TexData != nullptr);
+                bd->Stats.DrawCalls++;
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
@@ -672,16 +915,17 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
 
     // Restore modified GL state
+    // (Goes through the shadow-state cache too: states we did not end up changing are not re-submitted)
     // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
-    if (last_program == 0 || glIsProgram(last_program)) glUseProgram(last_program);
-    glBindTexture(GL_TEXTURE_2D, last_texture);
+    if (last_program == 0 || glIsProgram(last_program)) ImGui_ImplOpenGL3_UseProgram(bd, last_program);
+    ImGui_ImplOpenGL3_BindTexture(bd, last_texture);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->HasBindSampler)
         glBindSampler(0, last_sampler);
 #endif
     glActiveTexture(last_active_texture);
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindVertexArray(last_vertex_array_object);
+    ImGui_ImplOpenGL3_BindVertexArray(bd, last_vertex_array_object);
 #endif
     glBindBuffer(GL_ARRAY_BUFFER, last_array_buffer);
 #ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
@@ -690,13 +934,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     last_vtx_attrib_state_uv.SetState(bd->AttribLocationVtxUV);
     last_vtx_attrib_state_color.SetState(bd->AttribLocationVtxColor);
 #endif
-    glBlendEquationSeparate(last_blend_equation_rgb, last_blend_equation_alpha);
-    glBlendFuncSeparate(last_blend_src_rgb, last_blend_dst_rgb, last_blend_src_alpha, last_blend_dst_alpha);
-    if (last_enable_blend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
-    if (last_enable_cull_face) glEnable(GL_CULL_FACE); else glDisable(GL_CULL_FACE);
-    if (last_enable_depth_test) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST);
-    if (last_enable_stencil_test) glEnable(GL_STENCIL_TEST); else glDisable(GL_STENCIL_TEST);
-    if (last_enable_scissor_test) glEnable(GL_SCISSOR_TEST); else glDisable(GL_SCISSOR_TEST);
+    ImGui_ImplOpenGL3_SetBlendEquation(bd, last_blend_equation_rgb, last_blend_equation_alpha);
+    ImGui_ImplOpenGL3_SetBlendFunc(bd, last_blend_src_rgb, last_blend_dst_rgb, last_blend_src_alpha, last_blend_dst_alpha);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_BLEND, ImGui_ImplOpenGL3_StateBit_EnableBlend, &sc.EnableBlend, last_enable_blend);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_CULL_FACE, ImGui_ImplOpenGL3_StateBit_EnableCullFace, &sc.EnableCullFace, last_enable_cull_face);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_DEPTH_TEST, ImGui_ImplOpenGL3_StateBit_EnableDepthTest, &sc.EnableDepthTest, last_enable_depth_test);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_STENCIL_TEST, ImGui_ImplOpenGL3_StateBit_EnableStencilTest, &sc.EnableStencilTest, last_enable_stencil_test);
+    ImGui_ImplOpenGL3_SetEnabled(bd, GL_SCISSOR_TEST, ImGui_ImplOpenGL3_StateBit_EnableScissorTest, &sc.EnableScissorTest, last_enable_scissor_test);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     if (!bd->GlProfileIsES3 && bd->GlVersion >= 310) { if (last_enable_primitive_restart) glEnable(GL_PRIMITIVE_RESTART); else glDisable(GL_PRIMITIVE_RESTART); }
 #endif
@@ -707,8 +951,31 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif // IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
 
     glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
-    glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
-    (void)bd; // Not all compilation paths use this
+    ImGui_ImplOpenGL3_SetScissor(bd, last_scissor_box[0], last_scissor_box[1], last_scissor_box[2], last_scissor_box[3]);
+}
+
+void ImGui_ImplOpenGL3_SetCompactVertices(bool enable)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    bd->UseCompactVertices = enable;
+}
+
+void ImGui_ImplOpenGL3_SetPartialRedraw(bool enable, const float* clear_color)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    bd->UsePartialRedraw = enable;
+    bd->PartialRedrawClear = (clear_color != nullptr);
+    if (clear_color != nullptr)
+        memcpy(bd->PartialRedrawClearColor, clear_color, sizeof(bd->PartialRedrawClearColor));
+}
+
+const ImGui_ImplOpenGL3_RenderStats* ImGui_ImplOpenGL3_GetRenderStats()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    return &bd->Stats;
 }
 
 static void ImGui_ImplOpenGL3_DestroyTexture(ImTextureData* tex)
@@ -918,42 +1185,62 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        "uniform int EnableDistanceField;\n"
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
+        "#ifdef GL_ES\n"
         "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "#else\n"
+        "    float sdf = float(EnableDistanceField) * step(2.0, Frag_UV.s);\n" // Distance field glyphs have U offset by IM_FONTGLYPH_DISTANCE_FIELD_UV_OFFSET
+        "    vec4 tex = texture2D(Texture, Frag_UV.st - vec2(2.0 * sdf, 0.0));\n"
+        "    float cov = clamp((tex.a - 0.5) / max(fwidth(tex.a), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    gl_FragColor = Frag_Color * mix(tex, vec4(1.0, 1.0, 1.0, cov), sdf);\n"
+        "#endif\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        "uniform int EnableDistanceField;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    float sdf = float(EnableDistanceField) * step(2.0, Frag_UV.s);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st - vec2(2.0 * sdf, 0.0));\n"
+        "    float cov = clamp((tex.a - 0.5) / max(fwidth(tex.a), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = Frag_Color * mix(tex, vec4(1.0, 1.0, 1.0, cov), sdf);\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        "uniform int EnableDistanceField;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    float sdf = float(EnableDistanceField) * step(2.0, Frag_UV.s);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st - vec2(2.0 * sdf, 0.0));\n"
+        "    float cov = clamp((tex.a - 0.5) / max(fwidth(tex.a), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = Frag_Color * mix(tex, vec4(1.0, 1.0, 1.0, cov), sdf);\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        "uniform int EnableDistanceField;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    float sdf = float(EnableDistanceField) * step(2.0, Frag_UV.s);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st - vec2(2.0 * sdf, 0.0));\n"
+        "    float cov = clamp((tex.a - 0.5) / max(fwidth(tex.a), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = Frag_Color * mix(tex, vec4(1.0, 1.0, 1.0, cov), sdf);\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -1012,6 +1299,7 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationEnableDistanceField = glGetUniformLocation(bd->ShaderHandle, "EnableDistanceField");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
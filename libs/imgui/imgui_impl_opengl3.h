@@ -43,6 +43,28 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyDeviceObjects();
 // (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex);
 
+// [BETA] Upload vertices using the 12 bytes ImDrawVertCompact layout instead of 20 bytes ImDrawVert, reducing vertex bandwidth.
+// Draw lists which cannot be represented (see ImDrawList::BuildCompactVtxBuffer()) are uploaded as regular ImDrawVert. Default to false.
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_SetCompactVertices(bool enable);
+
+// [BETA] Only clear and draw the union of ImDrawData::DamageRects[] (requires io.ConfigDrawDataTrackChanges, otherwise the whole display is damaged).
+// Your framebuffer MUST still contain the previous frame: e.g. render into your own FBO, or use EGL_SWAP_BEHAVIOR == EGL_BUFFER_PRESERVED.
+// - clear_color: RGBA color to clear damaged area with before drawing (replacing your own glClear() call), or nullptr to not clear. Clear color state is not restored.
+// Nothing is drawn when there is no damage. Default to false.
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_SetPartialRedraw(bool enable, const float* clear_color = nullptr);
+
+// [BETA] Statistics for the last ImGui_ImplOpenGL3_RenderDrawData() call.
+// The backend keeps a shadow copy of the GL state it touches and skips calls which would not change anything.
+struct ImGui_ImplOpenGL3_RenderStats
+{
+    int     StateCallsSubmitted;    // State changes (texture/scissor/blend/program/VAO/enable bits) sent to the driver
+    int     StateCallsSkipped;      // State changes skipped because the shadow state already matched
+    int     DrawCalls;              // Number of glDrawElements()/glDrawElementsBaseVertex() calls
+    int     VtxBytesUploaded;       // Size of vertex data uploaded (smaller with ImGui_ImplOpenGL3_SetCompactVertices(true))
+    int     PixelsDrawn;            // Area of framebuffer cleared/drawn into (smaller with ImGui_ImplOpenGL3_SetPartialRedraw(true))
+};
+IMGUI_IMPL_API const ImGui_ImplOpenGL3_RenderStats* ImGui_ImplOpenGL3_GetRenderStats();
+
 // Configuration flags to add in your imconfig file:
 //#define IMGUI_IMPL_OPENGL_ES2     // Enable ES 2 (Auto-detected on Emscripten)
 //#define IMGUI_IMPL_OPENGL_ES3     // Enable ES 3 (Auto-detected on iOS/Android)
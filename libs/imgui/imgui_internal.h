@@ -31,6 +31,7 @@ Index of this file:
 // [SECTION] Localization support
 // [SECTION] Error handling, State recovery support
 // [SECTION] Metrics, Debug tools
+// [SECTION] Memory budget
 // [SECTION] Generic context hooks
 // [SECTION] ImGuiContext (main imgui context)
 // [SECTION] ImGuiWindowTempData, ImGuiWindow
@@ -68,10 +69,30 @@ Index of this file:
 #include <nmmintrin.h>
 #endif
 #endif
+#if defined(IMGUI_ENABLE_SSE) && (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
+#if defined(IMGUI_ENABLE_SSE) && defined(__AVX2__)
+#define IMGUI_ENABLE_AVX2
+#endif
 // Emscripten has partial SSE 4.2 support where _mm_crc32_u32 is not available. See https://emscripten.org/docs/porting/simd.html#id11 and #8213
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
+// Otherwise, ImHashData()/ImHashStr() detect hardware CRC32 support at runtime (x86: SSE 4.2, AArch64: ARMv8 CRC32 extension) and fall back to the lookup table.
+// Both paths compute the same CRC so IDs don't depend on the CPU. Define IMGUI_DISABLE_CRC32_DISPATCH to always use the lookup table.
+#if !defined(IMGUI_ENABLE_SSE4_2_CRC) && !defined(IMGUI_DISABLE_CRC32_DISPATCH) && !defined(__EMSCRIPTEN__)
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && (defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__))
+#define IMGUI_ENABLE_SSE4_2_CRC_DISPATCH   // SSE 4.2 'crc32' instruction computes CRC32c, which is incompatible with the legacy table
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && (defined(__ARM_FEATURE_CRC32) || defined(_M_ARM64) || (defined(__linux__) && (defined(__GNUC__) || defined(__clang__))))
+#define IMGUI_ENABLE_ARM_CRC_DISPATCH      // ARMv8 has instructions for both CRC32c and the legacy CRC32
+#endif
+#endif
+// Enable NEON intrinsics if available (AArch64 only)
+#if (defined(__aarch64__) || defined(_M_ARM64)) && (defined(__ARM_NEON) || defined(_M_ARM64)) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -140,6 +161,7 @@ struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImDrawListDamageState;       // Per draw list state of last frame, to compute ImDrawData::DamageRects[]
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
@@ -356,6 +378,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helper: ImBitArray
 // - Helper: ImBitVector
 // - Helper: ImSpan<>, ImSpanAllocator<>
+// - Helper: ImFrameArena
 // - Helper: ImStableVector<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
@@ -367,12 +390,22 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
 IMGUI_API const char*   ImHashSkipUncontributingPrefix(const char* label);
+IMGUI_API ImU64         ImHashData64(const void* data, size_t data_size, ImU64 seed = 0);  // Fast 64-bit hash for large buffers (e.g. vertex data). Not compatible with ImHashData().
+IMGUI_API const char*   ImHashGetCrc32Backend();                                            // Name of CRC32 implementation used by ImHashData()/ImHashStr(): "SSE 4.2", "ARMv8 CRC32" or "Table".
+IMGUI_API void          ImHashDebugForceSoftwareCrc32(bool force);                          // Force use of the lookup table when hardware CRC32 is detected at runtime (for benchmarking). Hashes are identical either way. Not thread-safe: call while no other thread is hashing.
+IMGUI_API bool          ImHashDebugSelfTest(unsigned int seed, int iterations, char* out_log, int out_log_size); // Compare ImHashData()/ImHashStr() with a bitwise reference on random inputs. Return true on success.
 
 // Helpers: Sorting
 #ifndef ImQsort
 inline void             ImQsort(void* base, size_t count, size_t size_of_element, int(IMGUI_CDECL *compare_func)(void const*, void const*)) { if (count > 1) qsort(base, count, size_of_element, compare_func); }
 #endif
 
+// Helpers: Self-tests and benchmarks
+// - ImDebugRandom(): xorshift32 generator, 'state' must be non-zero. Deterministic for a given seed so failures can be replayed.
+// - ImDebugSelfTestFunc: signature shared by Im***DebugSelfTest***() functions. Run 'iterations' random cases from 'seed', write the first mismatch or a summary into 'out_log'. Return true on success.
+typedef bool            (*ImDebugSelfTestFunc)(unsigned int seed, int iterations, char* out_log, int out_log_size);
+inline ImU32            ImDebugRandom(ImU32* state)         { ImU32 x = *state; x ^= x << 13; x ^= x >> 17; x ^= x << 5; return *state = x; }
+
 // Helpers: Color Blending
 IMGUI_API ImU32         ImAlphaBlendColors(ImU32 col_a, ImU32 col_b);
 
@@ -380,7 +413,7 @@ IMGUI_API ImU32         ImAlphaBlendColors(ImU32 col_a, ImU32 col_b);
 inline bool             ImIsPowerOfTwo(int v)               { return v != 0 && (v & (v - 1)) == 0; }
 inline bool             ImIsPowerOfTwo(ImU64 v)             { return v != 0 && (v & (v - 1)) == 0; }
 inline int              ImUpperPowerOfTwo(int v)            { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
-inline unsigned int     ImCountSetBits(unsigned int v)      { unsigned int count = 0; while (v > 0) { v = v & (v - 1); count++; } return count; }
+inline unsigned int     ImCountSetBits(unsigned int v)      { v = v - ((v >> 1) & 0x55555555); v = (v & 0x33333333) + ((v >> 2) & 0x33333333); return (((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24; }
 
 // Helpers: String
 #define ImStrlen strlen
@@ -428,6 +461,8 @@ IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, cons
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_p);                           // return previous UTF-8 code-point.
 IMGUI_API const char*   ImTextFindValidUtf8CodepointEnd(const char* in_text_start, const char* in_text_end, const char* in_p);  // return previous UTF-8 code-point if 'in_p' is not the end of a valid one.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
+IMGUI_API const char*   ImTextSkipPrintableAscii(const char* in_text, const char* in_text_end);                                 // return first byte which is not printable ASCII (32..127): a control character or part of a multi-byte UTF-8 sequence.
+IMGUI_API bool          ImTextDebugSelfTestUtf8(unsigned int seed, int iterations, char* out_log, int out_log_size);           // compare SIMD text functions with their scalar reference on random inputs. return true on success.
 
 // Helpers: High-level text functions (DO NOT USE!!! THIS IS A MINIMAL SUBSET OF LARGER UPCOMING CHANGES)
 enum ImDrawTextFlags_
@@ -450,6 +485,7 @@ inline bool                 ImFileClose(ImFileHandle)
 inline ImU64                ImFileGetSize(ImFileHandle)                             { return (ImU64)-1; }
 inline ImU64                ImFileRead(void*, ImU64, ImU64, ImFileHandle)           { return 0; }
 inline ImU64                ImFileWrite(const void*, ImU64, ImU64, ImFileHandle)    { return 0; }
+inline bool                 ImFileSeek(ImFileHandle, ImU64)                         { return false; }
 #endif
 #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 typedef FILE* ImFileHandle;
@@ -458,11 +494,25 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileSeek(ImFileHandle file, ImU64 offset);                // Set absolute position, return true on success
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
+// Helpers: Read-only File Mapping
+// - Maps the file with mmap()/MapViewOfFile() when available, so pages are shared between processes and only faulted in when accessed.
+// - Otherwise (or if mapping fails) falls back to ImFileLoadToMemory(), in which case IsMapped is false and Data was allocated with IM_ALLOC().
+struct ImFileMapping
+{
+    void*   Data;
+    size_t  Size;
+    bool    IsMapped;
+    ImFileMapping() { Data = NULL; Size = 0; IsMapped = false; }
+};
+IMGUI_API bool              ImFileMap(const char* filename, ImFileMapping* out_mapping);
+IMGUI_API void              ImFileUnmap(ImFileMapping* mapping);
+
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
 // - Wrapper for standard libs functions. (Note that imgui_demo.cpp does _not_ use them to keep the code easy to copy)
@@ -710,6 +760,47 @@ struct ImSpanAllocator
     inline void  GetSpan(int n, ImSpan<T>* span)    { span->set((T*)GetSpanPtrBegin(n), (T*)GetSpanPtrEnd(n)); }
 };
 
+// Helper: ImFrameArena
+// Linear allocator for transient allocations, all released at once by Reset(). The context owns one which is reset in NewFrame(), see ImGui::MemAllocFrame().
+// - Allocations are served from a single block. When it is full we allocate overflow blocks with IM_ALLOC(), and on Reset() we replace them
+//   with a single block large enough for the high-water mark, so steady-state frames perform no heap allocation.
+// - No individual free and no destructor call. Sizes are rounded up to 16 bytes, alignment is the same as IM_ALLOC().
+// - Local scratch usage may save a marker with GetMarker() and release everything allocated since with Rewind(), within the same frame.
+struct ImFrameArenaMarker
+{
+    char*       Cur;
+    size_t      UsedBytes;
+    int         OverflowCount;
+};
+
+struct IMGUI_API ImFrameArena
+{
+    char*       Block;                  // Main block (BlockSize bytes)
+    size_t      BlockSize;
+    char*       Cur;                    // Current position in main block or latest overflow block
+    char*       End;
+    void*       OverflowHead;           // Linked list of overflow blocks allocated since last Reset() (each starts with a pointer to the next)
+    size_t      UsedBytes;              // Bytes allocated since last Reset()
+    int         AllocCount;             // Number of Alloc() calls since last Reset()
+    int         OverflowCount;          // Number of heap allocations since last Reset()
+    size_t      LastFrameUsedBytes;     // Statistics for the period between the two last calls to Reset()
+    int         LastFrameAllocCount;
+    int         LastFrameOverflowCount;
+    size_t      HighWaterBytes;         // Maximum of UsedBytes over all periods
+    size_t      RecentPeakBytes;        // Maximum of UsedBytes over the last RecentPeriods periods, to release the main block after a one-off large usage
+    int         RecentPeriods;
+
+    ImFrameArena()                                  { memset(this, 0, sizeof(*this)); }
+    ~ImFrameArena()                                 { ClearFreeMemory(); }
+    void*       Alloc(size_t size);
+    template<typename T>
+    T*          AllocArray(int count)               { return (T*)Alloc(sizeof(T) * (size_t)count); }
+    ImFrameArenaMarker GetMarker() const            { ImFrameArenaMarker marker = { Cur, UsedBytes, OverflowCount }; return marker; }
+    void        Rewind(const ImFrameArenaMarker& marker) { if (marker.OverflowCount == OverflowCount) { Cur = marker.Cur; UsedBytes = marker.UsedBytes; } } // Allocations which needed a new block are only released by Reset()
+    void        Reset();
+    void        ClearFreeMemory();
+};
+
 // Helper: ImStableVector<>
 // Allocating chunks of BLOCKSIZE items. Objects pointers are never invalidated when growing, only by clear().
 // Important: does not destruct anything!
@@ -884,6 +975,84 @@ struct ImDrawDataBuilder
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
 
+// Stored for each draw list (by index in ImDrawData::CmdLists[]) when io.ConfigDrawDataTrackChanges is set.
+struct ImDrawListDamageState
+{
+    ImU64                   Hash;           // ImDrawList::CalcContentHash()
+    ImRect                  Bounds;         // Union of clip rectangles of all commands, clipped to vertices bounding box and display
+    bool                    HasCallbacks;   // Contains user callbacks (other than ImDrawCallback_ResetRenderState): always considered changed
+};
+
+// Helper to merge compatible draw commands across the draw lists of a ImDrawData and drop fully clipped ones.
+// Merged commands are copied into draw lists owned by this structure, so the source lists (which may be retained by user code) are never modified.
+// Lists containing user callbacks are passed through untouched, as callbacks receive their parent list.
+struct IMGUI_API ImDrawDataOptimizer
+{
+    ImVector<ImDrawList*>   OutputLists;                // Owned draw lists receiving merged contents
+    int                     OutputListsUsed;            // Number of OutputLists[] in use since last Reset()
+    ImVector<int>           ListCulledCount;            // [Temporary] Per source list: number of culled commands, -1 if the list cannot be merged
+    unsigned int            SegmentVtxBase;             // [Temporary] VtxOffset of the current output segment
+
+    // Statistics accumulated since last Reset()
+    int                     CmdListsBefore;
+    int                     CmdListsAfter;
+    int                     CmdsBefore;                 // Draw commands (excluding user callbacks) before optimization
+    int                     CmdsAfter;
+    int                     CmdsCulled;                 // Commands dropped because they were empty or fully clipped
+
+    ImDrawDataOptimizer()   { memset(this, 0, sizeof(*this)); }
+    ~ImDrawDataOptimizer()  { ClearFreeMemory(); }
+    void    Reset()         { OutputListsUsed = 0; CmdListsBefore = CmdListsAfter = CmdsBefore = CmdsAfter = CmdsCulled = 0; }
+    void    Optimize(ImDrawData* draw_data, bool allow_vtx_offset);
+    void    ClearFreeMemory();
+};
+
+// Cache of CalcTextSize() results, used when io.ConfigTextSizeCache is enabled.
+// Open-addressing hash table with linear probing, keyed by 64-bit hash of (baked font, font size, wrap width, text). Key 0 marks an empty slot.
+// Entries unused for a few frames are evicted by GarbageCollect(). Cleared whenever a baked font is discarded, as its metrics may change when reloaded.
+struct ImGuiTextSizeCacheEntry
+{
+    ImU64                   Key;                        // 64-bit so collisions are negligible, unlike the 32-bit ImHashStr()
+    int                     LastUsedFrame;
+    ImVec2                  Size;
+};
+
+struct IMGUI_API ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;          // Power-of-two sized table
+    ImVector<ImGuiTextSizeCacheEntry> EntriesTemp;      // [Temporary] Swapped with Entries[] when rehashing, so steady state doesn't allocate
+    int                     EntriesCount;               // Number of non-empty slots in Entries[]
+
+    // Statistics
+    int                     HitCount;                   // Current frame
+    int                     MissCount;
+    int                     HitCountLastFrame;
+    int                     MissCountLastFrame;
+    int                     EvictedCountLastFrame;
+
+    ImGuiTextSizeCache()    { EntriesCount = HitCount = MissCount = HitCountLastFrame = MissCountLastFrame = EvictedCountLastFrame = 0; }
+    void    Clear()         { Entries.resize(0); EntriesCount = 0; }
+    void    ClearFreeMemory() { Entries.clear(); EntriesTemp.clear(); EntriesCount = 0; }
+    ImGuiTextSizeCacheEntry* Find(ImU64 key);
+    void    Add(ImU64 key, int frame_count, const ImVec2& size);
+    void    GarbageCollect(int frame_count, int unused_frames);
+};
+
+// Line-break index of a long word-wrapped text, cached by TextEx() so only visible lines are measured and rendered.
+// One slot per call site: text which changes (e.g. a growing log) is rebuilt in place instead of piling up stale entries.
+// Slots with Key == 0 are unused and may be reused.
+struct ImGuiTextWrapLayout
+{
+    ImGuiID                 SiteId;                     // Call site, see TextEx()
+    ImGuiID                 Key;                        // Hash of (baked font, font size, wrap width, text)
+    int                     TextLen;                    // Also compared on lookup, to reduce the odds of hash collisions
+    int                     LastUsedFrame;
+    ImVec2                  Size;                       // == CalcTextSize(text, text_end, false, wrap_width)
+    ImVector<int>           LineOffsets;                // Offset of the first character of each visual line
+
+    ImGuiTextWrapLayout()   { SiteId = Key = 0; TextLen = LastUsedFrame = 0; }
+};
+
 struct ImFontStackData
 {
     ImFont*     Font;
@@ -1660,10 +1829,11 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    float                           ItemStartPosY;          // Variable height mode: cursor position before the displayed item, to measure it on next step
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; ItemStartPosY = 0.0f; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1952,6 +2122,9 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    float               DrawDataLastDisplayParams[6];   // DrawDataP.DisplayPos/DisplaySize/FramebufferScale of last frame, for io.ConfigDrawDataTrackChanges
+    ImVector<ImDrawListDamageState> DrawDataLastLists;  // Draw lists of last frame, to compute DrawDataP.DamageRects[]
+    ImVector<ImDrawListDamageState> DrawDataCurrLists;  // Temporary, swapped with DrawDataLastLists
 
     // Per-viewport work area
     // - Insets are >= 0.0f values, distance from viewport corners to work area.
@@ -1962,7 +2135,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImVec2              BuildWorkInsetMin;      // Work Area inset accumulator for current frame, to become next frame's WorkInset
     ImVec2              BuildWorkInsetMax;      // "
 
-    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
+    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; memset(DrawDataLastDisplayParams, 0, sizeof(DrawDataLastDisplayParams)); }
     ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
@@ -2007,11 +2180,44 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, int version, ImGuiID id, const void* data, int data_size); // Read: Called for every binary record of this type (optional: types without binary support are stored as .ini text in the binary file)
+    void        (*WriteBinFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* out_buf);       // Write: Output every entries into 'out_buf' with BinSettingsAddRecord() (optional)
+    int         BinVersion;     // Version of the binary records written by WriteBinFn, passed back to ReadBinFn so it can convert or ignore older data
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
+// Binary settings file (io.BinSettingsFilename)
+// - A header followed by records. Each record holds one settings entry of one handler, identified by (TypeHash, ID).
+// - Records reserve some spare capacity so that entries which change are rewritten in place. Records which don't fit anymore are marked dead and appended again.
+// - Handlers without ReadBinFn/WriteBinFn are stored as a single record of .ini text (ID == 0).
+// - Native endianness: the file is a local cache of the settings, use the .ini functions to exchange settings between machines.
+enum ImGuiBinSettingsRecordFlags_
+{
+    ImGuiBinSettingsRecordFlags_None    = 0,
+    ImGuiBinSettingsRecordFlags_Dead    = 1 << 0,   // Entry was deleted or moved to the end of the file
+    ImGuiBinSettingsRecordFlags_Text    = 1 << 1,   // Payload is .ini text from WriteAllFn()
+};
+
+struct ImGuiBinSettingsRecordHeader
+{
+    ImGuiID     TypeHash;       // == ImGuiSettingsHandler::TypeHash
+    ImGuiID     ID;             // Entry identifier within its handler
+    ImU16       Version;        // == ImGuiSettingsHandler::BinVersion when written
+    ImU16       Flags;          // ImGuiBinSettingsRecordFlags_
+    ImU32       Size;           // Payload size in bytes
+    ImU32       Capacity;       // Payload size reserved in the file (>= Size, multiple of 4). Next record starts right after.
+};
+
+// Live record in ImGuiContext::SettingsBinImage, sorted by Key. The full (TypeHash, ID) pair is the key so distinct entries never collide.
+struct ImGuiBinSettingsIndexEntry
+{
+    ImU64       Key;            // ((ImU64)TypeHash << 32) | ID
+    int         Offset;         // Offset of record header in SettingsBinImage, -1 once the record was marked dead
+    bool        Written;        // Temporary: written by current SaveBinSettingsToDisk()
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Localization support
 //-----------------------------------------------------------------------------
@@ -2098,6 +2304,29 @@ struct ImGuiDebugAllocInfo
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+// Heap tags: name the subsystem responsible for allocations made inside a scope, for allocators installed with SetAllocatorFunctions() (e.g. heap profilers).
+// - Opt-in with '#define IMGUI_ENABLE_HEAP_TAGS'. Scopes are placed on code paths which allocate (buffer growth, creation), not on per-item entry points.
+// - Nested scopes form a path (e.g. "Frame" > "FrameArena"). Allocators read GImDebugHeapTagStack.Tags[0..Depth-1], Depth may exceed IM_ARRAYSIZE(Tags).
+// - Tags are static strings. The stack is per thread: allocations made by worker threads (e.g. font loader jobs) get their own path.
+// - GImDebugHeapTagStack is thread_local, which can't be exported from a DLL: allocators need to be linked with the library.
+#ifdef IMGUI_ENABLE_HEAP_TAGS
+struct ImGuiDebugHeapTagStack
+{
+    const char* Tags[16];
+    int         Depth;
+};
+extern thread_local ImGuiDebugHeapTagStack GImDebugHeapTagStack;
+
+struct ImGuiDebugHeapTagScope
+{
+    ImGuiDebugHeapTagScope(const char* tag) { ImGuiDebugHeapTagStack* s = &GImDebugHeapTagStack; if (s->Depth < IM_ARRAYSIZE(s->Tags)) s->Tags[s->Depth] = tag; s->Depth++; }
+    ~ImGuiDebugHeapTagScope()               { GImDebugHeapTagStack.Depth--; }
+};
+#define IMGUI_DEBUG_HEAP_TAG_SCOPE(_TAG)    ImGuiDebugHeapTagScope debug_heap_tag_scope(_TAG)
+#else
+#define IMGUI_DEBUG_HEAP_TAG_SCOPE(_TAG)    do {} while (0)
+#endif
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -2151,6 +2380,28 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset(this, 0, sizeof(*this)); LastActiveFrame = -1; OptHexEncodeNonAsciiChars = true; CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Memory budget
+//-----------------------------------------------------------------------------
+
+// Candidate for io.ConfigMemoryCompactBudget, see GcCompactTransientBuffersToBudget()
+enum ImGuiGcBudgetEntryType
+{
+    ImGuiGcBudgetEntryType_Window,              // Transient buffers of a window unused since last frame
+    ImGuiGcBudgetEntryType_WindowDrawList,      // Excess capacity of the draw list of a window in use
+    ImGuiGcBudgetEntryType_Table,
+    ImGuiGcBudgetEntryType_TableTempData,
+    ImGuiGcBudgetEntryType_FontBaked,
+};
+
+struct ImGuiGcBudgetEntry
+{
+    ImGuiGcBudgetEntryType  Type;
+    int                     Age;                // Number of frames since last use. Entries are freed by decreasing age.
+    size_t                  Size;               // Estimated reclaimable bytes
+    void*                   Data;               // ImGuiWindow*, ImGuiTable*, ImGuiTableTempData* or ImFontBaked*
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -2373,6 +2624,9 @@ struct ImGuiContext
 
     // Render
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and Ctrl+Tab list)
+    ImDrawDataOptimizer     DrawDataOptimizer;                  // Used when io.ConfigDrawDataOptimize is enabled
+    ImGuiTextSizeCache      TextSizeCache;                      // Used by CalcTextSize() when io.ConfigTextSizeCache is enabled
+    ImVector<ImGuiTextWrapLayout> TextWrapLayouts;              // Used by TextEx() for long word-wrapped text
 
     // Drag and Drop
     bool                    DragDropActive;
@@ -2486,6 +2740,11 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImVector<char>          SettingsBinImage;                   // Content of the binary settings file as of the last load/save, to find which bytes need to be rewritten
+    ImVector<ImGuiBinSettingsIndexEntry> SettingsBinIndex;      // Live records in SettingsBinImage, sorted by (TypeHash, ID)
+    ImGuiID                 SettingsBinImageFilenameHash;       // Hash of the file SettingsBinImage comes from
+    int                     SettingsBinDeadBytes;               // Bytes used by dead records in SettingsBinImage, compacted with a full rewrite when they exceed the live ones
+    int                     SettingsBinLastWriteBytes;          // [DEBUG] Bytes written by last save
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2551,6 +2810,12 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;             // Copied in EndFrame() from g.PlatformImeData.WantTextInput. Needs to be set for some backends (SDL3) to emit character inputs.
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImFrameArena            FrameArena;                         // Transient allocations released at the beginning of next frame. See MemAllocFrame().
+    ImVector<ImGuiGcBudgetEntry> GcBudgetEntries;               // Candidates for io.ConfigMemoryCompactBudget (persistent to avoid allocations)
+    size_t                  GcBudgetUsedBytes;                  // Estimated size of buffers accounted by io.ConfigMemoryCompactBudget, before last collection
+    size_t                  GcBudgetReclaimedBytes;             // Bytes reclaimed by the last frame that exceeded io.ConfigMemoryCompactBudget
+    size_t                  GcBudgetReclaimedBytesTotal;
+    int                     GcBudgetCollectCount;               // Number of frames that exceeded io.ConfigMemoryCompactBudget
     char                    TempKeychordName[64];
 
     ImGuiContext(ImFontAtlas* shared_font_atlas);
@@ -2729,6 +2994,7 @@ struct IMGUI_API ImGuiWindow
 
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
+    int                     MemoryDrawListShrinkFrame;          // Last frame the idx/vtx buffers of this window in use were shrunk by io.ConfigMemoryCompactBudget
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
 
 public:
@@ -3067,6 +3333,7 @@ struct IMGUI_API ImGuiTableTempData
     ImGuiID                     WindowID;                   // Shortcut to g.Tables[TableIndex]->OuterWindow->ID.
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
     float                       LastTimeActive;             // Last timestamp this structure was used
+    int                         LastFrameActive;            // Last frame this structure was used (for io.ConfigMemoryCompactBudget)
     float                       AngledHeadersExtraWidth;    // Used in EndTable()
     ImVector<ImGuiTableHeaderData> AngledHeadersRequests;   // Used in TableAngledHeadersRow()
 
@@ -3221,6 +3488,7 @@ namespace ImGui
     IMGUI_API void                  AddSettingsHandler(const ImGuiSettingsHandler* handler);
     IMGUI_API void                  RemoveSettingsHandler(const char* type_name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API void*                 BinSettingsAddRecord(ImVector<char>* out_buf, ImGuiSettingsHandler* handler, ImGuiID id, const void* data, int data_size); // Return payload storage, where 'data' was copied if not NULL
 
     // Settings - Windows
     IMGUI_API ImGuiWindowSettings*  CreateNewWindowSettings(const char* name);
@@ -3529,6 +3797,8 @@ namespace ImGui
     IMGUI_API void          TableRemove(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTableTempData* table);
+    IMGUI_API size_t        TableGcCalcTransientBuffersSize(ImGuiTable* table);
+    IMGUI_API size_t        TableGcCalcTransientBuffersSize(ImGuiTableTempData* table);
     IMGUI_API void          TableGcCompactSettings();
 
     // Tables: Settings
@@ -3592,6 +3862,7 @@ namespace ImGui
 
     // Widgets: Text
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
+    IMGUI_API ImGuiTextWrapLayout* GetTextWrapLayout(ImGuiID site_id, const char* text, const char* text_end, float wrap_width); // Pointer valid until next call
     IMGUI_API void          TextAligned(float align_x, float size_x, const char* fmt, ...);               // FIXME-WIP: Works but API is likely to be reworked. This is designed for 1 item on the line. (#7024)
     IMGUI_API void          TextAlignedV(float align_x, float size_x, const char* fmt, va_list args);
 
@@ -3674,6 +3945,7 @@ namespace ImGui
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcCompactTransientBuffersToBudget(size_t budget);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
 
     // Error handling, State Recovery
@@ -3758,6 +4030,7 @@ struct ImFontLoader
     bool            (*FontBakedInit)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
+    void            (*FontBakedLoadGlyphs)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, const ImWchar* codepoints, int codepoints_count, ImFontGlyph* out_glyphs, bool* out_found); // Optional: same as calling FontBakedLoadGlyph() for each codepoint, may use atlas->ParallelForFunc.
 
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
@@ -3779,6 +4052,9 @@ typedef ImFontLoader ImFontBuilderIO; // [renamed/changed in 1.92] The types are
 
 #define IMGUI_FONT_SIZE_MAX                                     (512.0f)
 #define IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE      (128.0f)
+#define IMGUI_FONT_PARALLEL_LOAD_MIN_GLYPHS                     (4)         // Minimum number of missing glyphs in a text to use ImFontLoader::FontBakedLoadGlyphs() + ImFontAtlas::ParallelForFunc
+#define IMGUI_FONT_DISTANCE_FIELD_SIZE                          (32.0f)     // Reference size distance field glyphs are baked at (ImFontFlags_DistanceField)
+#define IMGUI_FONT_DISTANCE_FIELD_SPREAD                        (4)         // Distance range in pixels encoded around distance field glyph edges (also padding around glyph bitmaps)
 
 // Helpers: ImTextureRef ==/!= operators provided as convenience
 // (note that _TexID and _TexData are never set simultaneously)
@@ -3894,20 +4170,25 @@ IMGUI_API void              ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFo
 IMGUI_API ImGuiID           ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
-IMGUI_API ImFontBaked*      ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id);
+IMGUI_API ImFontBaked*      ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id, bool distance_field = false);
+IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAddDistanceField(ImFontAtlas* atlas, ImFont* font);
 IMGUI_API void              ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked);
 IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph);
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
 
+IMGUI_API ImU64             ImFontAtlasGlyphCacheGetFontKey(ImFontAtlas* atlas, ImFont* font);
+IMGUI_API bool              ImFontAtlasGlyphCacheSaveToMemory(ImFontAtlas* atlas, ImVector<char>* out_buf);
+IMGUI_API int               ImFontAtlasGlyphCacheLoadFromMemory(ImFontAtlas* atlas, const void* data, size_t data_size); // Return number of glyphs added, -1 if data is not a valid cache.
+
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
 IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 
-IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
+IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures, bool renderer_has_distance_fields = false);
 IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex);
@@ -3916,6 +4197,8 @@ IMGUI_API void              ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* at
 IMGUI_API void              ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data, float multiply_factor);
+IMGUI_API void              ImFontAtlasTextureBlockPostProcessGamma(ImFontAtlasPostProcessData* data, float gamma);
+IMGUI_API bool              ImFontAtlasDebugSelfTestTextureBlocks(unsigned int seed, int iterations, char* out_log, int out_log_size); // Compare SIMD conversion/post-processing with scalar reference on random blocks. Return true on success.
 IMGUI_API void              ImFontAtlasTextureBlockFill(ImTextureData* dst_tex, int dst_x, int dst_y, int w, int h, ImU32 col);
 IMGUI_API void              ImFontAtlasTextureBlockCopy(ImTextureData* src_tex, int src_x, int src_y, ImTextureData* dst_tex, int dst_x, int dst_y, int w, int h);
 IMGUI_API void              ImFontAtlasTextureBlockQueueUpload(ImFontAtlas* atlas, ImTextureData* tex, int x, int y, int w, int h);
@@ -556,6 +556,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesLastTimeActive.resize(table_idx + 1, -1.0f);
     g.TablesLastTimeActive[table_idx] = (float)g.Time;
     temp_data->LastTimeActive = (float)g.Time;
+    temp_data->LastFrameActive = g.FrameCount;
     table->MemoryCompacted = false;
 
     // Setup memory buffer (clear data if columns count changed)
@@ -655,6 +656,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 // Unused channels don't perform their +2 allocations.
 void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("Tables");
     // Allocate single buffer for our arrays
     const int columns_bit_array_size = (int)ImBitArrayGetStorageSizeInBytes(columns_count);
     ImSpanAllocator<6> span_allocator;
@@ -3632,6 +3634,8 @@ void ImGui::TableDrawDefaultContextMenu(ImGuiTable* table, ImGuiTableFlags flags
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadBin() [Internal]
+// - TableSettingsHandler_WriteBin() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3848,13 +3852,9 @@ static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandle
         }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+// Recycle existing settings if they are large enough, otherwise create new ones
+static ImGuiTableSettings* TableSettingsFindOrCreateForLoad(ImGuiID id, int columns_count)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
     {
         if (settings->ColumnsCountMax >= columns_count)
@@ -3867,6 +3867,15 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*,
     return ImGui::TableSettingsCreate(id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsFindOrCreateForLoad(id, columns_count);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3933,6 +3942,89 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
     }
 }
 
+// Binary record: ImGuiTableSettingsBin followed by ImGuiTableColumnSettingsBin[ColumnsCount]
+struct ImGuiTableSettingsBin
+{
+    ImGuiTableFlags             SaveFlags;
+    float                       RefScale;
+    ImS32                       ColumnsCount;
+};
+
+struct ImGuiTableColumnSettingsBin
+{
+    float                       WidthOrWeight;
+    ImGuiID                     UserID;
+    ImGuiTableColumnIdx         Index;
+    ImGuiTableColumnIdx         DisplayOrder;
+    ImGuiTableColumnIdx         SortOrder;
+    ImU8                        SortDirection;
+    ImS8                        IsEnabled;
+    ImU8                        IsStretch;
+    ImU8                        Padding[3];
+};
+
+static void TableSettingsHandler_ReadBin(ImGuiContext*, ImGuiSettingsHandler*, int version, ImGuiID id, const void* data, int data_size)
+{
+    if (version != 1 || data_size < (int)sizeof(ImGuiTableSettingsBin))
+        return;
+    ImGuiTableSettingsBin bin;
+    memcpy(&bin, data, sizeof(bin));
+    if (bin.ColumnsCount < 0 || bin.ColumnsCount > IMGUI_TABLE_MAX_COLUMNS || data_size != (int)sizeof(bin) + bin.ColumnsCount * (int)sizeof(ImGuiTableColumnSettingsBin))
+        return;
+
+    ImGuiTableSettings* settings = TableSettingsFindOrCreateForLoad(id, bin.ColumnsCount);
+    settings->SaveFlags = bin.SaveFlags;
+    settings->RefScale = bin.RefScale;
+    const char* column_data = (const char*)data + sizeof(bin);
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < bin.ColumnsCount; column_n++, column++, column_data += sizeof(ImGuiTableColumnSettingsBin))
+    {
+        ImGuiTableColumnSettingsBin column_bin;
+        memcpy(&column_bin, column_data, sizeof(column_bin));
+        column->WidthOrWeight = column_bin.WidthOrWeight;
+        column->UserID = column_bin.UserID;
+        column->Index = column_bin.Index;
+        column->DisplayOrder = column_bin.DisplayOrder;
+        column->SortOrder = column_bin.SortOrder;
+        column->SortDirection = column_bin.SortDirection;
+        column->IsEnabled = column_bin.IsEnabled;
+        column->IsStretch = column_bin.IsStretch;
+    }
+}
+
+static void TableSettingsHandler_WriteBin(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* buf)
+{
+    ImGuiContext& g = *ctx;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0) // Skip ditched settings
+            continue;
+
+        ImGuiTableSettingsBin bin;
+        bin.SaveFlags = settings->SaveFlags;
+        bin.RefScale = settings->RefScale;
+        bin.ColumnsCount = settings->ColumnsCount;
+        char* data = (char*)ImGui::BinSettingsAddRecord(buf, handler, settings->ID, NULL, (int)sizeof(bin) + settings->ColumnsCount * (int)sizeof(ImGuiTableColumnSettingsBin));
+        memcpy(data, &bin, sizeof(bin));
+        data += sizeof(bin);
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++, data += sizeof(ImGuiTableColumnSettingsBin))
+        {
+            ImGuiTableColumnSettingsBin column_bin;
+            memset(&column_bin, 0, sizeof(column_bin));
+            column_bin.WidthOrWeight = column->WidthOrWeight;
+            column_bin.UserID = column->UserID;
+            column_bin.Index = column->Index;
+            column_bin.DisplayOrder = column->DisplayOrder;
+            column_bin.SortOrder = column->SortOrder;
+            column_bin.SortDirection = (ImU8)column->SortDirection;
+            column_bin.IsEnabled = (ImS8)column->IsEnabled;
+            column_bin.IsStretch = (ImU8)column->IsStretch;
+            memcpy(data, &column_bin, sizeof(column_bin));
+        }
+    }
+}
+
 void ImGui::TableSettingsAddSettingsHandler()
 {
     ImGuiSettingsHandler ini_handler;
@@ -3943,6 +4035,9 @@ void ImGui::TableSettingsAddSettingsHandler()
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinFn = TableSettingsHandler_ReadBin;
+    ini_handler.WriteBinFn = TableSettingsHandler_WriteBin;
+    ini_handler.BinVersion = 1;
     AddSettingsHandler(&ini_handler);
 }
 
@@ -3951,6 +4046,7 @@ void ImGui::TableSettingsAddSettingsHandler()
 //-------------------------------------------------------------------------
 // - TableRemove() [Internal]
 // - TableGcCompactTransientBuffers() [Internal]
+// - TableGcCalcTransientBuffersSize() [Internal]
 // - TableGcCompactSettings() [Internal]
 //-------------------------------------------------------------------------
 
@@ -3988,6 +4084,21 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTableTempData* temp_data)
     temp_data->LastTimeActive = -1.0f;
 }
 
+// Estimate size of buffers freed by TableGcCompactTransientBuffers(), for io.ConfigMemoryCompactBudget
+size_t ImGui::TableGcCalcTransientBuffersSize(ImGuiTable* table)
+{
+    return (size_t)table->SortSpecsMulti.Capacity * sizeof(ImGuiTableColumnSortSpecs) + (size_t)table->ColumnsNames.Buf.Capacity;
+}
+
+size_t ImGui::TableGcCalcTransientBuffersSize(ImGuiTableTempData* temp_data)
+{
+    const ImDrawListSplitter* splitter = &temp_data->DrawSplitter;
+    size_t size = (size_t)splitter->_Channels.Capacity * sizeof(ImDrawChannel);
+    for (const ImDrawChannel& channel : splitter->_Channels)
+        size += (size_t)channel._CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)channel._IdxBuffer.Capacity * sizeof(ImDrawIdx);
+    return size;
+}
+
 // Compact and remove unused settings data (currently only used by TestEngine)
 void ImGui::TableGcCompactSettings()
 {
@@ -156,6 +156,61 @@ static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin,
 // - BulletTextV()
 //-------------------------------------------------------------------------
 
+// Find or build line-break index for a word-wrapped text.
+// Lines are split exactly as ImFont::RenderText() would: wrap position from the start of each line, then skip blanks and one '\n'.
+ImGuiTextWrapLayout* ImGui::GetTextWrapLayout(ImGuiID site_id, const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+    struct { ImGuiID BakedId; float FontSize; float WrapWidth; } key_data = { g.FontBaked->BakedId, g.FontSize, wrap_width };
+    ImGuiID key = ImHashData(text, (size_t)text_len, ImHashData(&key_data, sizeof(key_data))); // Not ImHashStr(): "###" must not reset the hash
+    if (key == 0)
+        key = 1;
+
+    // Lookup by call site. A site whose text or layout changed rebuilds its own slot, otherwise use a free slot.
+    // Slots already used this frame are not replaced: several texts may share a site (e.g. two ranges of the same buffer).
+    ImGuiTextWrapLayout* layout = NULL;
+    for (ImGuiTextWrapLayout& slot : g.TextWrapLayouts)
+    {
+        if (slot.Key == 0)
+        {
+            if (layout == NULL)
+                layout = &slot;
+            continue;
+        }
+        if (slot.SiteId != site_id)
+            continue;
+        if (slot.Key == key && slot.TextLen == text_len)
+        {
+            slot.LastUsedFrame = g.FrameCount;
+            return &slot;
+        }
+        if (slot.LastUsedFrame != g.FrameCount && (layout == NULL || layout->Key == 0))
+            layout = &slot;
+    }
+    if (layout == NULL)
+    {
+        g.TextWrapLayouts.push_back(ImGuiTextWrapLayout());
+        layout = &g.TextWrapLayouts.back();
+    }
+
+    // Build
+    layout->SiteId = site_id;
+    layout->Key = key;
+    layout->TextLen = text_len;
+    layout->LastUsedFrame = g.FrameCount;
+    layout->Size = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, wrap_width, text, text_end, NULL);
+    layout->Size.x = IM_TRUNC(layout->Size.x + 0.99999f); // Same rounding as CalcTextSize()
+    layout->LineOffsets.resize(0);
+    for (const char* s = text; s < text_end; )
+    {
+        layout->LineOffsets.push_back((int)(s - text));
+        s = ImFontCalcWordWrapPositionEx(g.Font, g.FontSize, s, text_end, wrap_width);
+        s = ImTextCalcWordWrapNextLineStart(s, text_end);
+    }
+    return layout;
+}
+
 void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -175,7 +230,36 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
     const ImVec2 text_pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
     const float wrap_pos_x = window->DC.TextWrapPos;
     const bool wrap_enabled = (wrap_pos_x >= 0.0f);
-    if (text_end - text <= 2000 || wrap_enabled)
+    if (wrap_enabled && text_end - text > 2000 && !g.LogEnabled)
+    {
+        // Long word-wrapped text!
+        // Use cached line-break index: size is known without measuring, and we only submit lines around the visible area.
+        // - Submitting a few extra lines after the last visible one ensures it wraps the same as with the full text.
+        // - Unless the first submitted line is the first line, its position is pixel aligned, which may differ by a fraction of pixel
+        //   from rendering the full text when line height is not an integer.
+        // - Call site is identified by the text pointer within the ID stack, which stays the same for a buffer growing in place.
+        const float wrap_width = CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x);
+        const ImGuiTextWrapLayout* layout = GetTextWrapLayout(window->GetID((const void*)text_begin), text_begin, text_end, wrap_width);
+        const ImVec2 text_size = layout->Size;
+
+        ImRect bb(text_pos, text_pos + text_size);
+        ItemSize(text_size, 0.0f);
+        if (!ItemAdd(bb, 0))
+            return;
+
+        const float line_height = g.FontSize;
+        const ImVec4& clip_rect = window->DrawList->_CmdHeader.ClipRect;
+        const float y0 = IM_TRUNC(text_pos.y);
+        const int lines_count = layout->LineOffsets.Size;
+        int line_first = 0;
+        if (y0 + line_height < clip_rect.y)
+            line_first = ImClamp((int)((clip_rect.y - y0) / line_height) - 1, 0, lines_count - 1);
+        const int line_last = line_first + (int)((clip_rect.w - clip_rect.y) / line_height) + 4;
+        const char* render_begin = text_begin + layout->LineOffsets[line_first];
+        const char* render_end = (line_last < lines_count) ? text_begin + layout->LineOffsets[line_last] : text_end;
+        window->DrawList->AddText(g.Font, g.FontSize, ImVec2(text_pos.x, y0 + line_first * line_height), GetColorU32(ImGuiCol_Text), render_begin, render_end, wrap_width);
+    }
+    else if (text_end - text <= 2000 || wrap_enabled)
     {
         // Common case
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
@@ -4352,13 +4436,14 @@ void ImGui::PushPasswordFont()
 {
     ImGuiContext& g = *GImGui;
     ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0 && backup->IndexPageMap.Size == 0);
     ImFontGlyph* glyph = g.FontBaked->FindGlyph('*');
     g.InputTextPasswordFontBackupFlags = g.Font->Flags;
     backup->FallbackGlyphIndex = g.FontBaked->FallbackGlyphIndex;
     backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
     backup->IndexLookup.swap(g.FontBaked->IndexLookup);
     backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
+    backup->IndexPageMap.swap(g.FontBaked->IndexPageMap);
     g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
     g.FontBaked->FallbackGlyphIndex = g.FontBaked->Glyphs.index_from_ptr(glyph);
     g.FontBaked->FallbackAdvanceX = glyph->AdvanceX;
@@ -4373,7 +4458,8 @@ void ImGui::PopPasswordFont()
     g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
     g.FontBaked->IndexLookup.swap(backup->IndexLookup);
     g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    g.FontBaked->IndexPageMap.swap(backup->IndexPageMap);
+    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0 && backup->IndexPageMap.Size == 0);
 }
 
 // Return false to discard a character.
@@ -4633,6 +4719,7 @@ static ImVec2 InputTextLineIndexGetPosOffset(ImGuiContext& g, ImGuiInputTextStat
 // - If you want to use InputText() with std::string or any custom dynamic string type, use the wrapper in misc/cpp/imgui_stdlib.h/.cpp!
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
+    IMGUI_DEBUG_HEAP_TAG_SCOPE("InputText");
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -5157,8 +5244,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 // Filter pasted buffer
                 const int clipboard_len = (int)ImStrlen(clipboard);
                 const char* clipboard_end = clipboard + clipboard_len;
-                ImVector<char> clipboard_filtered;
-                clipboard_filtered.reserve(clipboard_len + 1);
+                // Invalid UTF-8 bytes are replaced with U+FFFD and a filter callback may replace characters: each byte can expand up to 4 bytes.
+                const int clipboard_filtered_max = clipboard_len * 4 + 1;
+                char* clipboard_filtered = g.FrameArena.AllocArray<char>(clipboard_filtered_max);
+                int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s != 0; )
                 {
                     unsigned int c;
@@ -5169,13 +5258,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     char c_utf8[5];
                     ImTextCharToUtf8(c_utf8, c);
                     int out_len = (int)ImStrlen(c_utf8);
-                    clipboard_filtered.resize(clipboard_filtered.Size + out_len);
-                    memcpy(clipboard_filtered.Data + clipboard_filtered.Size - out_len, c_utf8, out_len);
+                    if (clipboard_filtered_len + out_len >= clipboard_filtered_max)
+                        break;
+                    memcpy(clipboard_filtered + clipboard_filtered_len, c_utf8, out_len);
+                    clipboard_filtered_len += out_len;
                 }
-                if (clipboard_filtered.Size > 0) // If everything was filtered, ignore the pasting operation
+                if (clipboard_filtered_len > 0) // If everything was filtered, ignore the pasting operation
                 {
-                    clipboard_filtered.push_back(0);
-                    stb_textedit_paste(state, state->Stb, clipboard_filtered.Data, clipboard_filtered.Size - 1);
+                    clipboard_filtered[clipboard_filtered_len] = 0;
+                    stb_textedit_paste(state, state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
             }
@@ -6602,6 +6693,7 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - ImGuiVirtualTree
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -7250,6 +7342,160 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     return is_open;
 }
 
+//-------------------------------------------------------------------------
+
+ImGuiVirtualTree::ImGuiVirtualTree()
+{
+    UserData = NULL;
+    AdapterGetChildrenCount = NULL;
+    AdapterGetChild = NULL;
+}
+
+void ImGuiVirtualTree::Clear()
+{
+    Rows.clear();
+    _OpenBits.clear();
+    _ToggledRows.clear();
+    _TempRows.clear();
+    _TempStack.clear();
+}
+
+bool ImGuiVirtualTree::IsNodeOpen(int node_idx) const
+{
+    IM_ASSERT(node_idx >= 0);
+    return (node_idx >> 5) < _OpenBits.Size && (_OpenBits.Data[node_idx >> 5] & ((ImU32)1 << (node_idx & 31))) != 0;
+}
+
+static void ImGuiVirtualTree_SetOpenBit(ImGuiVirtualTree* tree, int node_idx, bool open)
+{
+    IM_ASSERT(node_idx >= 0);
+    if ((node_idx >> 5) >= tree->_OpenBits.Size)
+    {
+        if (!open)
+            return;
+        tree->_OpenBits.resize((node_idx >> 5) + 1, 0);
+    }
+    const ImU32 mask = (ImU32)1 << (node_idx & 31);
+    tree->_OpenBits.Data[node_idx >> 5] = open ? (tree->_OpenBits.Data[node_idx >> 5] | mask) : (tree->_OpenBits.Data[node_idx >> 5] & ~mask);
+}
+
+// Append visible descendants of 'node_idx' in display order, walking into open nodes.
+// Uses an explicit stack of (node, next child, children count) so very deep hierarchies don't overflow the call stack.
+static void ImGuiVirtualTree_AppendVisibleDescendants(ImGuiVirtualTree* tree, int node_idx, int depth, ImVector<ImGuiVirtualTreeRow>* out_rows)
+{
+    ImVector<int>& stack = tree->_TempStack;
+    stack.resize(0);
+    stack.push_back(node_idx);
+    stack.push_back(0);
+    stack.push_back(tree->AdapterGetChildrenCount(tree, node_idx));
+    while (stack.Size > 0)
+    {
+        int* parent = &stack.Data[stack.Size - 3];
+        if (parent[1] == parent[2])
+        {
+            stack.resize(stack.Size - 3);
+            continue;
+        }
+        ImGuiVirtualTreeRow row;
+        row.NodeIdx = tree->AdapterGetChild(tree, parent[0], parent[1]++);
+        row.Depth = depth + stack.Size / 3 - 1;
+        out_rows->push_back(row);
+        if (tree->IsNodeOpen(row.NodeIdx))
+        {
+            stack.push_back(row.NodeIdx);
+            stack.push_back(0);
+            stack.push_back(tree->AdapterGetChildrenCount(tree, row.NodeIdx));
+        }
+    }
+}
+
+void ImGuiVirtualTree::Build()
+{
+    IM_ASSERT(AdapterGetChildrenCount != NULL && AdapterGetChild != NULL);
+    Rows.resize(0);
+    _ToggledRows.resize(0);
+    ImGuiVirtualTree_AppendVisibleDescendants(this, -1, 0, &Rows);
+}
+
+// Opening inserts the visible descendants right after the row, closing removes the following rows which are deeper.
+void ImGuiVirtualTree::SetRowOpen(int row_n, bool open)
+{
+    IM_ASSERT(row_n >= 0 && row_n < Rows.Size);
+    const ImGuiVirtualTreeRow row = Rows.Data[row_n];
+    if (IsNodeOpen(row.NodeIdx) == open)
+        return;
+    ImGuiVirtualTree_SetOpenBit(this, row.NodeIdx, open);
+    if (open)
+    {
+        _TempRows.resize(0);
+        ImGuiVirtualTree_AppendVisibleDescendants(this, row.NodeIdx, row.Depth + 1, &_TempRows);
+        if (_TempRows.Size == 0)
+            return;
+        const int tail_size = Rows.Size - (row_n + 1);
+        Rows.resize(Rows.Size + _TempRows.Size);
+        memmove(Rows.Data + row_n + 1 + _TempRows.Size, Rows.Data + row_n + 1, (size_t)tail_size * sizeof(ImGuiVirtualTreeRow));
+        memcpy(Rows.Data + row_n + 1, _TempRows.Data, (size_t)_TempRows.Size * sizeof(ImGuiVirtualTreeRow));
+    }
+    else
+    {
+        int row_end = row_n + 1;
+        while (row_end < Rows.Size && Rows.Data[row_end].Depth > row.Depth)
+            row_end++;
+        if (row_end > row_n + 1)
+            Rows.erase(Rows.Data + row_n + 1, Rows.Data + row_end);
+    }
+}
+
+void ImGuiVirtualTree::SetNodeOpen(int node_idx, bool open)
+{
+    if (IsNodeOpen(node_idx) == open)
+        return;
+    for (int row_n = 0; row_n < Rows.Size; row_n++)
+        if (Rows.Data[row_n].NodeIdx == node_idx)
+        {
+            SetRowOpen(row_n, open);
+            return;
+        }
+    ImGuiVirtualTree_SetOpenBit(this, node_idx, open); // Not visible: only rows of visible nodes need updating
+}
+
+// All rows share a single storage slot in the window: we feed our own open state with SetNextItemOpen(), so TreeNodeBehavior()
+// never needs to store one entry per node. Rows are indented manually and don't TreePush(), which keeps the ID stack flat.
+bool ImGuiVirtualTree::TreeNodeRow(int row_n, const char* label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    const ImGuiVirtualTreeRow row = Rows[row_n];
+    if (AdapterGetChildrenCount(this, row.NodeIdx) == 0)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    window->DC.CursorPos.x += row.Depth * g.Style.IndentSpacing;
+    ImGui::SetNextItemStorageID(window->GetID("##VirtualTreeOpen"));
+    ImGui::SetNextItemOpen(IsNodeOpen(row.NodeIdx), ImGuiCond_Always);
+    const bool is_open = ImGui::TreeNodeBehavior(window->GetID(row.NodeIdx), flags | ImGuiTreeNodeFlags_NoTreePushOnOpen, label);
+    if (g.LastItemData.StatusFlags & ImGuiItemStatusFlags_ToggledOpen)
+        _ToggledRows.push_back(row_n);
+    return is_open;
+}
+
+static int IMGUI_CDECL RowComparerDescending(const void* lhs, const void* rhs)
+{
+    return *(const int*)rhs - *(const int*)lhs;
+}
+
+// Apply toggles from the last row upward, so that rows toggled earlier in the list keep their index.
+void ImGuiVirtualTree::ApplyToggledRows()
+{
+    if (_ToggledRows.Size > 1)
+        ImQsort(_ToggledRows.Data, (size_t)_ToggledRows.Size, sizeof(int), RowComparerDescending);
+    for (int row_n : _ToggledRows)
+        if (row_n < Rows.Size)
+            SetRowOpen(row_n, !IsNodeOpen(Rows.Data[row_n].NodeIdx));
+    _ToggledRows.resize(0);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -8390,6 +8636,7 @@ void ImGui::DebugNodeMultiSelectState(ImGuiMultiSelectState* storage)
 //-------------------------------------------------------------------------
 // - ImGuiSelectionBasicStorage
 // - ImGuiSelectionExternalStorage
+// - ImGuiSelectionRangeStorage
 //-------------------------------------------------------------------------
 
 ImGuiSelectionBasicStorage::ImGuiSelectionBasicStorage()
@@ -8406,6 +8653,8 @@ void ImGuiSelectionBasicStorage::Clear()
     Size = 0;
     _SelectionOrder = 1; // Always >0
     _Storage.Data.resize(0);
+    _Storage.HashIndex.resize(0);
+    _Storage.HashIndexDataSize = 0;
 }
 
 void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
@@ -8413,6 +8662,9 @@ void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
     ImSwap(Size, r.Size);
     ImSwap(_SelectionOrder, r._SelectionOrder);
     _Storage.Data.swap(r._Storage.Data);
+    _Storage.HashIndex.swap(r._Storage.HashIndex);
+    ImSwap(_Storage.HashIndexDataSize, r._Storage.HashIndexDataSize);
+    ImSwap(_Storage.HashThreshold, r._Storage.HashThreshold);
 }
 
 bool ImGuiSelectionBasicStorage::Contains(ImGuiID id) const
@@ -8460,6 +8712,16 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+    if (storage->HashIndex.Size != 0)
+    {
+        // Hashed storage: lookup and insertion are O(1), no need for deferred sorting.
+        int* p_int = storage->GetIntRef(id, 0);
+        if (selected == (*p_int != 0))
+            return;
+        *p_int = selected ? selection_order : 0;
+        selection->Size += selected ? +1 : -1;
+        return;
+    }
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
     if (selected == (is_contained && it->val_i != 0))
@@ -8474,8 +8736,8 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
 static void ImGuiSelectionBasicStorage_BatchFinish(ImGuiSelectionBasicStorage* selection, bool selected, int size_before_amends)
 {
     ImGuiStorage* storage = &selection->_Storage;
-    if (selected && selection->Size != size_before_amends)
-        storage->BuildSortByKey(); // When done selecting: sort everything
+    if (selected && selection->Size != size_before_amends && storage->HashIndex.Size == 0)
+        storage->BuildSortByKey(); // When done selecting: sort everything (this also builds HashIndex if above threshold)
 }
 
 // Apply requests coming from BeginMultiSelect() and EndMultiSelect().
@@ -8577,6 +8839,166 @@ void ImGuiSelectionExternalStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
     }
 }
 
+//-------------------------------------------------------------------------
+
+ImGuiSelectionRangeStorage::ImGuiSelectionRangeStorage()
+{
+    Size = 0;
+}
+
+void ImGuiSelectionRangeStorage::Clear()
+{
+    Size = 0;
+    _Ranges.resize(0);
+}
+
+void ImGuiSelectionRangeStorage::Swap(ImGuiSelectionRangeStorage& r)
+{
+    ImSwap(Size, r.Size);
+    _Ranges.swap(r._Ranges);
+}
+
+// Return index of the first range whose end is > 'idx' (or >= 'idx' when 'include_adjacent' is set), in [0..ranges_count]
+static int ImGuiSelectionRangeStorage_LowerBoundByEnd(const ImVector<int>& ranges, int idx, bool include_adjacent)
+{
+    int first = 0, count = ranges.Size / 2;
+    while (count > 0)
+    {
+        const int step = count >> 1;
+        const int end = ranges.Data[(first + step) * 2 + 1];
+        if (include_adjacent ? (end < idx) : (end <= idx))
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
+bool ImGuiSelectionRangeStorage::Contains(int idx) const
+{
+    const int range_n = ImGuiSelectionRangeStorage_LowerBoundByEnd(_Ranges, idx, false);
+    return range_n < _Ranges.Size / 2 && _Ranges.Data[range_n * 2] <= idx;
+}
+
+// Replace ranges [range_n, range_n + old_count) with 'new_count' ranges copied from 'new_ranges'
+static void ImGuiSelectionRangeStorage_ReplaceRanges(ImVector<int>& ranges, int range_n, int old_count, const int* new_ranges, int new_count)
+{
+    const int tail_begin = (range_n + old_count) * 2;
+    const int tail_size = ranges.Size - tail_begin;
+    if (new_count > old_count)
+        ranges.resize(ranges.Size + (new_count - old_count) * 2);
+    if (new_count != old_count)
+        memmove(ranges.Data + (range_n + new_count) * 2, ranges.Data + tail_begin, (size_t)tail_size * sizeof(int));
+    if (new_count < old_count)
+        ranges.resize(ranges.Size - (old_count - new_count) * 2);
+    if (new_count > 0)
+        memcpy(ranges.Data + range_n * 2, new_ranges, (size_t)new_count * 2 * sizeof(int));
+}
+
+// Affected ranges are located by binary search, then replaced by at most two ranges: selecting merges everything
+// overlapping or touching [begin, end) into a single range, unselecting keeps the parts sticking out on either side.
+void ImGuiSelectionRangeStorage::SetRangeSelected(int first_idx, int last_idx, bool selected)
+{
+    IM_ASSERT(first_idx >= 0 && first_idx <= last_idx && last_idx < INT_MAX);
+    const int begin = first_idx;
+    const int end = last_idx + 1;
+    const int ranges_count = _Ranges.Size / 2;
+    const int range_first = ImGuiSelectionRangeStorage_LowerBoundByEnd(_Ranges, begin, selected);
+    int range_last = range_first; // One past the last affected range
+    int affected_items = 0;
+    while (range_last < ranges_count && (selected ? (_Ranges.Data[range_last * 2] <= end) : (_Ranges.Data[range_last * 2] < end)))
+    {
+        affected_items += _Ranges.Data[range_last * 2 + 1] - _Ranges.Data[range_last * 2];
+        range_last++;
+    }
+
+    int new_ranges[4];
+    int new_count = 0;
+    if (selected)
+    {
+        new_ranges[0] = (range_last > range_first) ? ImMin(begin, _Ranges.Data[range_first * 2]) : begin;
+        new_ranges[1] = (range_last > range_first) ? ImMax(end, _Ranges.Data[range_last * 2 - 1]) : end;
+        new_count = 1;
+        Size += (new_ranges[1] - new_ranges[0]) - affected_items;
+    }
+    else
+    {
+        if (range_last == range_first)
+            return;
+        const int keep_before_begin = _Ranges.Data[range_first * 2];
+        const int keep_after_end = _Ranges.Data[range_last * 2 - 1];
+        Size -= affected_items - ImMax(begin - keep_before_begin, 0) - ImMax(keep_after_end - end, 0);
+        if (keep_before_begin < begin)
+        {
+            new_ranges[new_count * 2 + 0] = keep_before_begin;
+            new_ranges[new_count * 2 + 1] = begin;
+            new_count++;
+        }
+        if (keep_after_end > end)
+        {
+            new_ranges[new_count * 2 + 0] = end;
+            new_ranges[new_count * 2 + 1] = keep_after_end;
+            new_count++;
+        }
+    }
+    ImGuiSelectionRangeStorage_ReplaceRanges(_Ranges, range_first, range_last - range_first, new_ranges, new_count);
+}
+
+// The iterator stores the next index to return (+1 so that NULL means start)
+bool ImGuiSelectionRangeStorage::GetNextSelectedItem(void** opaque_it, int* out_idx)
+{
+    const int idx = (int)(intptr_t)*opaque_it;
+    const int range_n = ImGuiSelectionRangeStorage_LowerBoundByEnd(_Ranges, idx, false);
+    if (range_n >= _Ranges.Size / 2)
+    {
+        *out_idx = 0;
+        return false;
+    }
+    *out_idx = ImMax(idx, _Ranges.Data[range_n * 2]);
+    *opaque_it = (void*)(intptr_t)(*out_idx + 1);
+    return true;
+}
+
+// The iterator stores the next range number to return
+bool ImGuiSelectionRangeStorage::GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last)
+{
+    const int range_n = (int)(intptr_t)*opaque_it;
+    if (range_n >= _Ranges.Size / 2)
+    {
+        *out_first = *out_last = 0;
+        return false;
+    }
+    *out_first = _Ranges.Data[range_n * 2];
+    *out_last = _Ranges.Data[range_n * 2 + 1] - 1;
+    *opaque_it = (void*)(intptr_t)(range_n + 1);
+    return true;
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// SetAll and SetRange requests are applied as whole ranges, the number of items they cover doesn't matter.
+void ImGuiSelectionRangeStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected && ms_io->ItemsCount > 0)
+                SetRangeSelected(0, ms_io->ItemsCount - 1, true);
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            SetRangeSelected((int)req.RangeFirstItem, (int)req.RangeLastItem, req.Selected);
+        }
+    }
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ListBox
 //-------------------------------------------------------------------------
@@ -0,0 +1,51 @@
+// Headless.hpp - 无窗口 ImGui 帧 (单文件版本)
+// 不创建平台窗口和渲染器，用合成的 ImGuiIO 驱动 ImGui 帧，供 --test-zero-alloc 与基准测试程序共用。
+// 需要随机数时统一使用 ImDebugRandom()，同一种子下结果可复现。
+#pragma once
+#include <imgui.h>
+#include <imgui_internal.h>
+
+namespace app
+{
+    // 创建并设为当前的无窗口上下文：不读写 imgui.ini，纹理由 UpdateTexturesHeadless() 直接标记为已完成
+    inline ImGuiContext *CreateHeadlessContext(ImVec2 displaySize = ImVec2(1000.0f, 900.0f))
+    {
+        ImGuiContext *ctx = ImGui::CreateContext();
+        ImGuiIO &io = ImGui::GetIO();
+        io.DisplaySize = displaySize;
+        io.DeltaTime = 1.0f / 60.0f;
+        io.IniFilename = nullptr;
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+        return ctx;
+    }
+
+    // 无渲染器时直接把纹理请求标记为已完成
+    inline void UpdateTexturesHeadless()
+    {
+        for (ImTextureData *tex : ImGui::GetPlatformIO().Textures)
+            if (tex->Status == ImTextureStatus_WantCreate)
+            {
+                tex->SetTexID((ImTextureID)1);
+                tex->SetStatus(ImTextureStatus_OK);
+            }
+            else if (tex->Status == ImTextureStatus_WantUpdates)
+            {
+                tex->SetStatus(ImTextureStatus_OK);
+            }
+            else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+            {
+                tex->SetTexID(ImTextureID_Invalid);
+                tex->SetStatus(ImTextureStatus_Destroyed);
+            }
+    }
+
+    // 运行一帧：NewFrame()，提交 body() 中的界面，Render() 后处理纹理请求
+    template <typename F>
+    inline void RunHeadlessFrame(F &&body)
+    {
+        ImGui::NewFrame();
+        body();
+        ImGui::Render();
+        UpdateTexturesHeadless();
+    }
+}
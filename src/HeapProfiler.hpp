@@ -0,0 +1,428 @@
+// HeapProfiler.hpp - ImGui 堆分析器 (单文件版本)
+// 通过 ImGui::SetAllocatorFunctions() 安装的分配器包装：按 IMGUI_DEBUG_HEAP_TAG_SCOPE() 标签路径（如 "Frame" > "FrameArena"）归类每次分配，
+// 统计每条路径的存活字节、峰值与分配/释放次数（抖动），提供树形、火焰图、按标签汇总三种视图，并可导出到文本文件。
+// 稳态帧不经过 ImGui 分配器（见 --test-zero-alloc），因此常驻开启只在真正分配时才有额外开销。
+// 标签需要以 IMGUI_ENABLE_HEAP_TAGS 编译 ImGui，否则所有分配都归入根节点。标签栈按线程独立，工作线程的分配归入其自身的标签路径。
+#pragma once
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace app
+{
+    // 标签树节点，统计值只包含自身（不含子节点）
+    struct HeapProfilerNode
+    {
+        const char *name; // 标签（静态字符串），根节点为未打标签的分配
+        int parent;
+        int firstChild;
+        int nextSibling;
+        long long liveBytes;
+        long long liveCount;
+        long long peakBytes;
+        long long allocCount;
+        long long freeCount;
+        long long allocBytes; // 累计分配字节数
+    };
+
+    struct HeapProfilerAllocation
+    {
+        int node;
+        size_t size;
+    };
+
+    struct HeapProfiler
+    {
+        std::mutex mutex; // 字体加载的工作线程也会调用分配器（标签栈是 thread_local 的，无需加锁读取）
+        std::vector<HeapProfilerNode> nodes;
+        std::unordered_map<void *, HeapProfilerAllocation> allocations;
+        long long liveBytes = 0;
+        long long peakBytes = 0;
+    };
+
+    // 故意不释放：程序退出时全局对象析构期间仍可能有 ImGui 内存被释放
+    inline HeapProfiler &GetHeapProfiler()
+    {
+        static HeapProfiler *profiler = new HeapProfiler();
+        return *profiler;
+    }
+
+    inline int HeapProfilerFindOrAddChild(HeapProfiler &profiler, int parent, const char *name)
+    {
+        for (int n = profiler.nodes[parent].firstChild; n != -1; n = profiler.nodes[n].nextSibling)
+            if (profiler.nodes[n].name == name || strcmp(profiler.nodes[n].name, name) == 0)
+                return n;
+        HeapProfilerNode node = {};
+        node.name = name;
+        node.parent = parent;
+        node.firstChild = -1;
+        node.nextSibling = profiler.nodes[parent].firstChild;
+        profiler.nodes.push_back(node);
+        profiler.nodes[parent].firstChild = (int)profiler.nodes.size() - 1;
+        return profiler.nodes[parent].firstChild;
+    }
+
+    inline void *HeapProfilerAlloc(size_t size, void *)
+    {
+        void *ptr = malloc(size);
+        if (ptr == nullptr)
+            return nullptr;
+        HeapProfiler &profiler = GetHeapProfiler();
+        std::lock_guard<std::mutex> lock(profiler.mutex);
+        int nodeIdx = 0;
+#ifdef IMGUI_ENABLE_HEAP_TAGS
+        const ImGuiDebugHeapTagStack &tags = GImDebugHeapTagStack;
+        for (int n = 0; n < tags.Depth && n < IM_ARRAYSIZE(tags.Tags); n++)
+            if (n == 0 || (tags.Tags[n] != tags.Tags[n - 1] && strcmp(tags.Tags[n], tags.Tags[n - 1]) != 0)) // 合并递归进入的相同标签
+                nodeIdx = HeapProfilerFindOrAddChild(profiler, nodeIdx, tags.Tags[n]);
+#endif
+        HeapProfilerNode &node = profiler.nodes[nodeIdx];
+        node.liveBytes += (long long)size;
+        node.liveCount++;
+        node.peakBytes = std::max(node.peakBytes, node.liveBytes);
+        node.allocCount++;
+        node.allocBytes += (long long)size;
+        profiler.liveBytes += (long long)size;
+        profiler.peakBytes = std::max(profiler.peakBytes, profiler.liveBytes);
+        profiler.allocations[ptr] = HeapProfilerAllocation{nodeIdx, size};
+        return ptr;
+    }
+
+    inline void HeapProfilerFree(void *ptr, void *)
+    {
+        if (ptr == nullptr)
+            return;
+        {
+            HeapProfiler &profiler = GetHeapProfiler();
+            std::lock_guard<std::mutex> lock(profiler.mutex);
+            auto it = profiler.allocations.find(ptr);
+            if (it != profiler.allocations.end())
+            {
+                HeapProfilerNode &node = profiler.nodes[it->second.node];
+                node.liveBytes -= (long long)it->second.size;
+                node.liveCount--;
+                node.freeCount++;
+                profiler.liveBytes -= (long long)it->second.size;
+                profiler.allocations.erase(it);
+            }
+        }
+        free(ptr);
+    }
+
+    // 必须在 ImGui::CreateContext() 之前调用
+    inline void InstallHeapProfiler()
+    {
+        HeapProfiler &profiler = GetHeapProfiler();
+        if (profiler.nodes.empty())
+        {
+            HeapProfilerNode root = {};
+            root.name = "(未标记)";
+            root.parent = root.firstChild = root.nextSibling = -1;
+            profiler.nodes.push_back(root);
+        }
+        ImGui::SetAllocatorFunctions(HeapProfilerAlloc, HeapProfilerFree);
+    }
+
+    // 加锁复制一份统计数据，之后的显示与导出都不持有锁（显示本身也会经过分配器）
+    struct HeapProfilerSnapshot
+    {
+        std::vector<HeapProfilerNode> nodes;
+        std::vector<long long> inclusiveBytes; // 含子节点的存活字节数
+        std::vector<std::vector<int>> children; // 按 inclusiveBytes 从大到小排序
+        long long liveBytes = 0;
+        long long peakBytes = 0;
+    };
+
+    inline void TakeHeapProfilerSnapshot(HeapProfilerSnapshot &snapshot)
+    {
+        HeapProfiler &profiler = GetHeapProfiler();
+        {
+            std::lock_guard<std::mutex> lock(profiler.mutex);
+            snapshot.nodes = profiler.nodes;
+            snapshot.liveBytes = profiler.liveBytes;
+            snapshot.peakBytes = profiler.peakBytes;
+        }
+        const int count = (int)snapshot.nodes.size();
+        snapshot.inclusiveBytes.assign(count, 0);
+        snapshot.children.assign(count, std::vector<int>());
+        for (int n = count - 1; n >= 0; n--) // 子节点总是在父节点之后加入
+        {
+            const HeapProfilerNode &node = snapshot.nodes[n];
+            snapshot.inclusiveBytes[n] += node.liveBytes;
+            if (node.parent != -1)
+            {
+                snapshot.inclusiveBytes[node.parent] += snapshot.inclusiveBytes[n];
+                snapshot.children[node.parent].push_back(n);
+            }
+        }
+        for (std::vector<int> &children : snapshot.children)
+            std::sort(children.begin(), children.end(), [&](int a, int b) { return snapshot.inclusiveBytes[a] > snapshot.inclusiveBytes[b]; });
+    }
+
+    inline const char *FormatHeapBytes(char *buf, size_t bufSize, long long bytes)
+    {
+        if (bytes >= 1024 * 1024 || bytes <= -1024 * 1024)
+            snprintf(buf, bufSize, "%.2f MB", (double)bytes / (1024.0 * 1024.0));
+        else if (bytes >= 1024 || bytes <= -1024)
+            snprintf(buf, bufSize, "%.1f KB", (double)bytes / 1024.0);
+        else
+            snprintf(buf, bufSize, "%lld B", bytes);
+        return buf;
+    }
+
+    // 按标签名汇总（同一标签可能出现在多条路径下，例如工作线程根部的 "Fonts" 与 "Frame" > "Fonts"）
+    struct HeapProfilerTagTotal
+    {
+        const char *name;
+        long long liveBytes;
+        long long liveCount;
+        long long allocCount;
+        long long freeCount;
+        long long allocBytes;
+    };
+
+    inline std::vector<HeapProfilerTagTotal> ComputeHeapProfilerTagTotals(const HeapProfilerSnapshot &snapshot)
+    {
+        std::vector<HeapProfilerTagTotal> totals;
+        for (const HeapProfilerNode &node : snapshot.nodes)
+        {
+            auto it = std::find_if(totals.begin(), totals.end(), [&](const HeapProfilerTagTotal &total) { return strcmp(total.name, node.name) == 0; });
+            if (it == totals.end())
+                it = totals.insert(totals.end(), HeapProfilerTagTotal{node.name, 0, 0, 0, 0, 0});
+            it->liveBytes += node.liveBytes;
+            it->liveCount += node.liveCount;
+            it->allocCount += node.allocCount;
+            it->freeCount += node.freeCount;
+            it->allocBytes += node.allocBytes;
+        }
+        std::sort(totals.begin(), totals.end(), [](const HeapProfilerTagTotal &a, const HeapProfilerTagTotal &b) { return a.liveBytes > b.liveBytes; });
+        return totals;
+    }
+
+    inline void DumpHeapProfilerNode(FILE *f, const HeapProfilerSnapshot &snapshot, int nodeIdx, int depth)
+    {
+        const HeapProfilerNode &node = snapshot.nodes[nodeIdx];
+        char inclusive[32], self[32], peak[32], churn[32];
+        fprintf(f, "%12s %12s %12s %8lld %10lld %10lld %12s  %*s%s\n",
+                FormatHeapBytes(inclusive, sizeof(inclusive), snapshot.inclusiveBytes[nodeIdx]), FormatHeapBytes(self, sizeof(self), node.liveBytes),
+                FormatHeapBytes(peak, sizeof(peak), node.peakBytes), node.liveCount, node.allocCount, node.freeCount,
+                FormatHeapBytes(churn, sizeof(churn), node.allocBytes), depth * 2, "", node.name);
+        for (int child : snapshot.children[nodeIdx])
+            DumpHeapProfilerNode(f, snapshot, child, depth + 1);
+    }
+
+    // 导出当前统计到文本文件，返回是否成功
+    inline bool DumpHeapProfiler(const char *filename)
+    {
+        HeapProfilerSnapshot snapshot;
+        TakeHeapProfilerSnapshot(snapshot);
+        if (snapshot.nodes.empty())
+            return false;
+        FILE *f = fopen(filename, "w");
+        if (f == nullptr)
+            return false;
+        char live[32], peak[32];
+        fprintf(f, "ImGui 堆分析: 存活 %s, 峰值 %s\n\n", FormatHeapBytes(live, sizeof(live), snapshot.liveBytes), FormatHeapBytes(peak, sizeof(peak), snapshot.peakBytes));
+        fprintf(f, "存活(含子) / 存活(自身) / 峰值(自身) / 块数 / 分配次数 / 释放次数 / 累计分配 / 标签路径\n");
+        DumpHeapProfilerNode(f, snapshot, 0, 0);
+        fprintf(f, "\n按标签汇总 (存活 / 块数 / 分配次数 / 释放次数 / 累计分配 / 标签):\n");
+        for (const HeapProfilerTagTotal &total : ComputeHeapProfilerTagTotals(snapshot))
+        {
+            char churn[32];
+            fprintf(f, "%12s %8lld %10lld %10lld %12s  %s\n", FormatHeapBytes(live, sizeof(live), total.liveBytes),
+                    total.liveCount, total.allocCount, total.freeCount, FormatHeapBytes(churn, sizeof(churn), total.allocBytes), total.name);
+        }
+        fclose(f);
+        return true;
+    }
+
+    inline void ShowHeapProfilerTreeNode(const HeapProfilerSnapshot &snapshot, const std::vector<long long> &churnPerSecond, int nodeIdx)
+    {
+        const HeapProfilerNode &node = snapshot.nodes[nodeIdx];
+        const std::vector<int> &children = snapshot.children[nodeIdx];
+        char buf[32];
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanAllColumns | ImGuiTreeNodeFlags_DefaultOpen;
+        if (children.empty())
+            flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        const bool open = ImGui::TreeNodeEx((void *)(intptr_t)nodeIdx, flags, "%s", node.name);
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(FormatHeapBytes(buf, sizeof(buf), snapshot.inclusiveBytes[nodeIdx]));
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(FormatHeapBytes(buf, sizeof(buf), node.liveBytes));
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(FormatHeapBytes(buf, sizeof(buf), node.peakBytes));
+        ImGui::TableNextColumn();
+        ImGui::Text("%lld", node.liveCount);
+        ImGui::TableNextColumn();
+        ImGui::Text("%lld / %lld", node.allocCount, node.freeCount);
+        ImGui::TableNextColumn();
+        ImGui::Text("%lld", nodeIdx < (int)churnPerSecond.size() ? churnPerSecond[nodeIdx] : 0LL);
+        if (open && !children.empty())
+        {
+            for (int child : children)
+                ShowHeapProfilerTreeNode(snapshot, churnPerSecond, child);
+            ImGui::TreePop();
+        }
+    }
+
+    // 冰柱式火焰图：每层一行，宽度与含子节点的存活字节数成正比
+    inline void ShowHeapProfilerFlameNode(const HeapProfilerSnapshot &snapshot, int nodeIdx, ImVec2 pos, float width, float rowHeight)
+    {
+        if (width < 1.0f)
+            return;
+        const HeapProfilerNode &node = snapshot.nodes[nodeIdx];
+        ImDrawList *drawList = ImGui::GetWindowDrawList();
+        const ImVec2 rectMax(pos.x + width, pos.y + rowHeight);
+        const ImU32 hash = ImHashStr(node.name);
+        const ImU32 col = ImColor::HSV((float)(hash & 0xFF) / 255.0f * 0.15f, 0.55f + (float)((hash >> 8) & 0xFF) / 255.0f * 0.3f, 0.85f);
+        drawList->AddRectFilled(pos, rectMax, col);
+        drawList->AddRect(pos, rectMax, IM_COL32(0, 0, 0, 128));
+        const ImVec4 clipRect(pos.x, pos.y, rectMax.x - 2.0f, rectMax.y);
+        drawList->AddText(nullptr, 0.0f, ImVec2(pos.x + 3.0f, pos.y + (rowHeight - ImGui::GetFontSize()) * 0.5f), IM_COL32(0, 0, 0, 255), node.name, nullptr, 0.0f, &clipRect);
+        if (ImGui::IsMouseHoveringRect(pos, rectMax) && ImGui::IsWindowHovered())
+        {
+            char inclusive[32], self[32], peak[32];
+            ImGui::SetTooltip("%s\n存活(含子): %s\n存活(自身): %s\n峰值(自身): %s\n分配/释放: %lld / %lld", node.name,
+                              FormatHeapBytes(inclusive, sizeof(inclusive), snapshot.inclusiveBytes[nodeIdx]),
+                              FormatHeapBytes(self, sizeof(self), node.liveBytes), FormatHeapBytes(peak, sizeof(peak), node.peakBytes),
+                              node.allocCount, node.freeCount);
+        }
+        const long long total = snapshot.inclusiveBytes[nodeIdx];
+        float x = pos.x;
+        for (int child : snapshot.children[nodeIdx])
+        {
+            if (total <= 0 || snapshot.inclusiveBytes[child] <= 0)
+                break;
+            const float childWidth = width * (float)((double)snapshot.inclusiveBytes[child] / (double)total);
+            ShowHeapProfilerFlameNode(snapshot, child, ImVec2(x, pos.y + rowHeight), childWidth, rowHeight);
+            x += childWidth;
+        }
+    }
+
+    inline int GetHeapProfilerTreeDepth(const HeapProfilerSnapshot &snapshot, int nodeIdx)
+    {
+        int depth = 1;
+        for (int child : snapshot.children[nodeIdx])
+            depth = std::max(depth, 1 + GetHeapProfilerTreeDepth(snapshot, child));
+        return depth;
+    }
+
+    inline void ShowHeapProfilerWindow(bool *pOpen)
+    {
+        static HeapProfilerSnapshot snapshot;
+        static std::vector<long long> lastAllocCounts;
+        static std::vector<long long> churnPerSecond; // 最近一秒内各节点的分配次数
+        static auto lastChurnTime = std::chrono::steady_clock::now();
+        static char dumpStatus[128] = "";
+
+        ImGui::SetNextWindowSize(ImVec2(760, 420), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin("堆分析", pOpen))
+        {
+            ImGui::End();
+            return;
+        }
+        TakeHeapProfilerSnapshot(snapshot);
+        if (snapshot.nodes.empty())
+        {
+            ImGui::TextUnformatted("未安装堆分析器（需在 ImGui::CreateContext() 之前调用 app::InstallHeapProfiler()）。");
+            ImGui::End();
+            return;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastChurnTime >= std::chrono::seconds(1))
+        {
+            churnPerSecond.assign(snapshot.nodes.size(), 0);
+            for (size_t n = 0; n < snapshot.nodes.size(); n++)
+                churnPerSecond[n] = snapshot.nodes[n].allocCount - (n < lastAllocCounts.size() ? lastAllocCounts[n] : 0);
+            lastAllocCounts.resize(snapshot.nodes.size());
+            for (size_t n = 0; n < snapshot.nodes.size(); n++)
+                lastAllocCounts[n] = snapshot.nodes[n].allocCount;
+            lastChurnTime = now;
+        }
+
+        char live[32], peak[32];
+        ImGui::Text("存活 %s，峰值 %s，%d 条标签路径", FormatHeapBytes(live, sizeof(live), snapshot.liveBytes),
+                    FormatHeapBytes(peak, sizeof(peak), snapshot.peakBytes), (int)snapshot.nodes.size());
+        ImGui::SameLine();
+        if (ImGui::Button("导出到 imgui_heap.txt"))
+            snprintf(dumpStatus, sizeof(dumpStatus), DumpHeapProfiler("imgui_heap.txt") ? "已导出" : "导出失败");
+        if (dumpStatus[0])
+        {
+            ImGui::SameLine();
+            ImGui::TextUnformatted(dumpStatus);
+        }
+
+        if (ImGui::BeginTabBar("views"))
+        {
+            const ImGuiTableFlags tableFlags = ImGuiTableFlags_BordersV | ImGuiTableFlags_BordersOuterH | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+            if (ImGui::BeginTabItem("树形"))
+            {
+                if (ImGui::BeginTable("tree", 7, tableFlags))
+                {
+                    ImGui::TableSetupScrollFreeze(0, 1);
+                    ImGui::TableSetupColumn("标签路径", ImGuiTableColumnFlags_WidthStretch);
+                    ImGui::TableSetupColumn("存活(含子)", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("存活(自身)", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("峰值(自身)", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("块数", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("分配/释放", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("分配/秒", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableHeadersRow();
+                    ShowHeapProfilerTreeNode(snapshot, churnPerSecond, 0);
+                    ImGui::EndTable();
+                }
+                ImGui::EndTabItem();
+            }
+            if (ImGui::BeginTabItem("火焰图"))
+            {
+                const float rowHeight = ImGui::GetFrameHeight();
+                const ImVec2 pos = ImGui::GetCursorScreenPos();
+                const float width = ImGui::GetContentRegionAvail().x;
+                ShowHeapProfilerFlameNode(snapshot, 0, pos, width, rowHeight);
+                ImGui::Dummy(ImVec2(width, rowHeight * GetHeapProfilerTreeDepth(snapshot, 0)));
+                ImGui::EndTabItem();
+            }
+            if (ImGui::BeginTabItem("按标签"))
+            {
+                if (ImGui::BeginTable("tags", 5, tableFlags))
+                {
+                    ImGui::TableSetupScrollFreeze(0, 1);
+                    ImGui::TableSetupColumn("标签", ImGuiTableColumnFlags_WidthStretch);
+                    ImGui::TableSetupColumn("存活", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("块数", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("分配/释放", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableSetupColumn("累计分配", ImGuiTableColumnFlags_WidthFixed);
+                    ImGui::TableHeadersRow();
+                    for (const HeapProfilerTagTotal &total : ComputeHeapProfilerTagTotals(snapshot))
+                    {
+                        char buf[32];
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(total.name);
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(FormatHeapBytes(buf, sizeof(buf), total.liveBytes));
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%lld", total.liveCount);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%lld / %lld", total.allocCount, total.freeCount);
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(FormatHeapBytes(buf, sizeof(buf), total.allocBytes));
+                    }
+                    ImGui::EndTable();
+                }
+                ImGui::EndTabItem();
+            }
+            ImGui::EndTabBar();
+        }
+        ImGui::End();
+    }
+}
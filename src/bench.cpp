@@ -0,0 +1,511 @@
+// bench.cpp - ImGui 扩展的基准测试与校验（命令行程序，不创建窗口和 GPU 设备）
+// 用法: MyRelaxImGUIBench <模式>，模式见 main() 中的列表；校验失败时返回 1。
+// 需要 ImGui 上下文的模式使用 Headless.hpp 中的无窗口帧，随机数据统一由 ImDebugRandom() 生成。
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Headless.hpp"
+
+// 字体图集纹理处理基准测试（命令行参数 --bench-atlas）：
+// 先用随机数据将 SIMD 实现与标量参考实现逐字节比对，再测量 Alpha8->RGBA32 转换、乘法与 Gamma 后处理的吞吐量。
+// 与标量版本对比时，可定义 IMGUI_DISABLE_SSE 重新编译后再运行一次。
+static int RunAtlasBenchmark()
+{
+    char log[256];
+    const bool ok = ImFontAtlasDebugSelfTestTextureBlocks(1234, 20000, log, IM_ARRAYSIZE(log));
+    printf("自检: %s\n", log);
+
+    const int w = 2048, h = 2048, iterations = 20;
+    std::vector<unsigned char> alpha(w * h);
+    std::vector<ImU32> rgba(w * h);
+    for (int n = 0; n < w * h; n++)
+        alpha[n] = (unsigned char)((n * 7) ^ (n >> 11));
+
+    auto bench = [&](const char *name, auto &&func)
+    {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int it = 0; it < iterations; it++)
+            func();
+        const double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+        printf("%-24s %8.2f ms  %8.1f MPix/s\n", name, seconds * 1000.0 / iterations, (double)w * h * iterations / seconds / 1000000.0);
+    };
+    ImFontAtlasPostProcessData pp_alpha = {};
+    pp_alpha.Pixels = alpha.data();
+    pp_alpha.Format = ImTextureFormat_Alpha8;
+    pp_alpha.Pitch = w;
+    pp_alpha.Width = w;
+    pp_alpha.Height = h;
+    ImFontAtlasPostProcessData pp_rgba = pp_alpha;
+    pp_rgba.Pixels = rgba.data();
+    pp_rgba.Format = ImTextureFormat_RGBA32;
+    pp_rgba.Pitch = w * 4;
+
+    bench("Alpha8 -> RGBA32", [&]() { ImFontAtlasTextureBlockConvert(alpha.data(), ImTextureFormat_Alpha8, w, (unsigned char *)rgba.data(), ImTextureFormat_RGBA32, w * 4, w, h); });
+    bench("RGBA32 -> Alpha8", [&]() { ImFontAtlasTextureBlockConvert((const unsigned char *)rgba.data(), ImTextureFormat_RGBA32, w * 4, alpha.data(), ImTextureFormat_Alpha8, w, w, h); });
+    bench("Multiply Alpha8", [&]() { ImFontAtlasTextureBlockPostProcessMultiply(&pp_alpha, 1.0001f); });
+    bench("Multiply RGBA32", [&]() { ImFontAtlasTextureBlockPostProcessMultiply(&pp_rgba, 1.0001f); });
+    bench("Gamma Alpha8", [&]() { ImFontAtlasTextureBlockPostProcessGamma(&pp_alpha, 0.8f); });
+    bench("Gamma RGBA32", [&]() { ImFontAtlasTextureBlockPostProcessGamma(&pp_rgba, 0.8f); });
+    return ok ? 0 : 1;
+}
+
+// ID 哈希基准测试（命令行参数 --bench-hash）：
+// 先将 ImHashData()/ImHashStr() 与逐位计算的 CRC32 参考实现比对，再用几组典型标签测量 ImGui::GetID() 的吞吐量，
+// 分别使用运行时检测到的硬件 CRC32（SSE 4.2 / ARMv8）和查表实现，两者生成的 ID 完全相同。
+static int RunHashBenchmark()
+{
+    char log[256];
+    const bool ok = ImHashDebugSelfTest(1234, 20000, log, IM_ARRAYSIZE(log));
+    printf("自检: %s\n", log);
+
+    ImGuiContext *ctx = app::CreateHeadlessContext();
+
+    // 标签集合：短按钮文字、带序号的列表项、隐藏标签、"###" 固定 ID、较长的表头/树节点文字
+    const int labels_count = 1024;
+    std::vector<std::vector<char>> storage;
+    auto make_labels = [&](const char *fmt)
+    {
+        std::vector<const char *> labels;
+        for (int n = 0; n < labels_count; n++)
+        {
+            char buf[128];
+            snprintf(buf, sizeof(buf), fmt, n, n * 7);
+            storage.emplace_back(buf, buf + strlen(buf) + 1);
+            labels.push_back(storage.back().data());
+        }
+        return labels;
+    };
+    static const char *short_labels[] = {"OK", "Cancel", "Apply", "Save", "Load", "Reset", "Close", "Help"};
+    std::vector<const char *> sets[5];
+    sets[0].assign(short_labels, short_labels + IM_ARRAYSIZE(short_labels));
+    sets[1] = make_labels("Item %d");
+    sets[2] = make_labels("##hidden_%d_%d");
+    sets[3] = make_labels("Window %d###StableId%d");
+    sets[4] = make_labels("Column %d: some longer header or tree node label (%d)");
+    static const char *set_names[] = {"短标签", "列表项", "##隐藏标签", "###固定 ID", "长标签"};
+
+    const int iterations = 2000000;
+    app::RunHeadlessFrame([&]()
+    {
+        ImGui::Begin("Hash benchmark");
+        for (int force_software = 0; force_software < 2; force_software++)
+        {
+            ImHashDebugForceSoftwareCrc32(force_software != 0);
+            printf("实现: %s\n", ImHashGetCrc32Backend());
+            for (int set_n = 0; set_n < IM_ARRAYSIZE(sets); set_n++)
+            {
+                const std::vector<const char *> &labels = sets[set_n];
+                const int mask = (int)labels.size() - 1;
+                ImGuiID acc = 0;
+                auto t0 = std::chrono::high_resolution_clock::now();
+                for (int it = 0; it < iterations; it++)
+                    acc += ImGui::GetID(labels[it & mask]);
+                const double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+                printf("  %-14s %8.2f ns/ID  %8.1f M ID/s  (%08X)\n", set_names[set_n], seconds * 1e9 / iterations, iterations / seconds / 1000000.0, acc);
+            }
+        }
+        ImHashDebugForceSoftwareCrc32(false);
+        ImGui::End();
+    });
+    ImGui::DestroyContext(ctx);
+    return ok ? 0 : 1;
+}
+
+// ImGuiStorage 基准测试（命令行参数 --bench-storage）：
+// 比较有序数组（默认）与哈希索引（HashThreshold）两种后端：随机插入（如大量树节点的展开状态）、随机查找、多选存储的随机选择。
+static int RunStorageBenchmark()
+{
+    const int hash_threshold = (IMGUI_STORAGE_HASH_THRESHOLD > 0) ? IMGUI_STORAGE_HASH_THRESHOLD : 1024;
+    static const int sizes[] = {1000, 10000, 100000};
+    bool ok = true;
+    for (int size : sizes)
+    {
+        std::vector<ImGuiID> keys(size);
+        ImU32 rng = 1234;
+        for (ImGuiID &key : keys)
+            key = ImDebugRandom(&rng);
+        printf("%d 项:\n", size);
+        for (int hashed = 0; hashed < 2; hashed++)
+        {
+            ImGuiStorage storage;
+            storage.HashThreshold = hashed ? hash_threshold : -1;
+            auto t0 = std::chrono::high_resolution_clock::now();
+            for (int n = 0; n < size; n++)
+                storage.SetInt(keys[n], n);
+            auto t1 = std::chrono::high_resolution_clock::now();
+            int errors = 0;
+            const int lookups = 1000000;
+            for (int n = 0; n < lookups; n++)
+            {
+                const int key_n = (int)(((unsigned int)n * 7919u) % (unsigned int)size);
+                errors += (storage.GetInt(keys[key_n], -1) != key_n);
+            }
+            auto t2 = std::chrono::high_resolution_clock::now();
+
+            ImGuiSelectionBasicStorage selection;
+            selection._Storage.HashThreshold = storage.HashThreshold;
+            for (int n = 0; n < size; n++)
+                selection.SetItemSelected(keys[n], true);
+            for (int n = 0; n < size; n++)
+                errors += selection.Contains(keys[n]) ? 0 : 1;
+            auto t3 = std::chrono::high_resolution_clock::now();
+            ok &= (errors == 0);
+
+            printf("  %-8s 插入 %9.2f ms  查找 %7.2f ns/次  多选 %9.2f ms%s\n", hashed ? "哈希" : "有序",
+                std::chrono::duration<double, std::milli>(t1 - t0).count(),
+                std::chrono::duration<double, std::nano>(t2 - t1).count() / lookups,
+                std::chrono::duration<double, std::milli>(t3 - t2).count(), errors ? "  (错误)" : "");
+        }
+    }
+
+    // 窗口的 StateStorage 由 memset() 初始化（HashThreshold 为 0 即使用编译期默认值），超过阈值后也应切换到哈希索引
+    ImGuiContext *ctx = app::CreateHeadlessContext();
+    ImGuiWindow *window = IM_NEW(ImGuiWindow)(ctx, "StorageBench");
+    for (int n = 0; n < hash_threshold + 1; n++)
+        window->StateStorage.SetInt((ImGuiID)(n + 1), n);
+    const bool window_hashed = (window->StateStorage.HashIndex.Size > 0);
+    IM_DELETE(window);
+    ImGui::DestroyContext(ctx);
+    if (window_hashed != (IMGUI_STORAGE_HASH_THRESHOLD > 0))
+    {
+        printf("窗口 StateStorage 的哈希索引状态与 IMGUI_STORAGE_HASH_THRESHOLD 不一致\n");
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
+
+// 可变高度列表裁剪基准测试（命令行参数 --bench-clipper）：
+// 先用朴素前缀和校验 ImGuiListClipperHeights 的 Fenwick 树，再在无窗口的上下文中用 BeginVariableHeight() 显示 100 万行高度不一的列表，
+// 随机跳转滚动位置并统计每帧耗时；同时检查可见区域的上下边缘都被列表项覆盖（没有空白）。
+static int RunClipperBenchmark()
+{
+    // 校验：随机修改高度、查询位置、按位置查找、增减项数
+    int errors = 0;
+    {
+        ImGuiListClipperHeights heights;
+        heights.DefaultHeight = 10.0f;
+        heights.Resize(1000);
+        std::vector<double> ref(1000, 10.0);
+        ImU32 rng = 1234;
+        auto next = [&rng]() { return ImDebugRandom(&rng); };
+        for (int n = 0; n < 20000; n++)
+        {
+            const int count = (int)ref.size();
+            switch (next() % 4)
+            {
+            case 0:
+            {
+                const int item_n = (int)(next() % count);
+                ref[item_n] = (double)(next() % 50);
+                heights.SetItemHeight(item_n, (float)ref[item_n]);
+                break;
+            }
+            case 1:
+            {
+                const int item_n = (int)(next() % (count + 1));
+                double pos = 0.0;
+                for (int k = 0; k < item_n; k++)
+                    pos += ref[k];
+                errors += (heights.GetItemPos(item_n) != pos);
+                break;
+            }
+            case 2:
+            {
+                const double pos = (double)(next() % (ImU32)(heights.GetTotalHeight() + 20.0)) - 10.0;
+                int item_n = 0;
+                for (double y = 0.0; item_n < count && y + ref[item_n] <= pos; item_n++)
+                    y += ref[item_n];
+                errors += (heights.FindItemAtPos(pos) != ImMin(item_n, count - 1));
+                break;
+            }
+            default:
+            {
+                const int new_count = (next() % 2) ? count + (int)(next() % 50) : ImMax(1, count - (int)(next() % 50));
+                heights.Resize(new_count);
+                ref.resize(new_count, 10.0);
+                break;
+            }
+            }
+        }
+    }
+    printf("高度树校验: %d 处错误\n", errors);
+
+    const int items_count = 1000000;
+    const int jumps = 500;
+    ImGuiContext *ctx = app::CreateHeadlessContext();
+    ImGuiIO &io = ImGui::GetIO();
+
+    ImGuiListClipperHeights heights;
+    int gaps = 0;
+    auto frame = [&](float scroll_y)
+    {
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("列表", nullptr, ImGuiWindowFlags_NoSavedSettings);
+        if (scroll_y >= 0.0f)
+            ImGui::SetScrollY(scroll_y);
+        const ImRect clip_rect = ImGui::GetCurrentWindow()->ClipRect;
+        const float content_min_y = ImMax(clip_rect.Min.y, ImGui::GetCursorScreenPos().y); // 滚动到顶部时列表从窗口内边距之后开始
+        float first_y = FLT_MAX, last_y = -FLT_MAX;
+        ImGuiListClipper clipper;
+        clipper.BeginVariableHeight(items_count, &heights);
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                first_y = ImMin(first_y, ImGui::GetCursorScreenPos().y);
+                if (n % 7 == 0)
+                    ImGui::Text("%d\n第二行\n第三行", n);
+                else
+                    ImGui::Text("%d", n);
+                last_y = ImGui::GetCursorScreenPos().y;
+            }
+        gaps += (scroll_y < 0.0f && (first_y > content_min_y + 0.5f || last_y < clip_rect.Max.y - 0.5f));
+        ImGui::End();
+    };
+    app::RunHeadlessFrame([&]() { frame(-1.0f); });
+    app::RunHeadlessFrame([&]() { frame(-1.0f); });
+
+    double total_ms = 0.0, worst_ms = 0.0;
+    ImU32 rng = 5678;
+    for (int n = 0; n < jumps; n++)
+    {
+        const float scroll_y = (float)(ImDebugRandom(&rng) % (ImU32)heights.GetTotalHeight());
+        auto t0 = std::chrono::high_resolution_clock::now();
+        app::RunHeadlessFrame([&]() { frame(scroll_y); });
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t0).count();
+        total_ms += ms;
+        worst_ms = ImMax(worst_ms, ms);
+        app::RunHeadlessFrame([&]() { frame(-1.0f); }); // 滚动在下一帧生效，检查此时的覆盖情况
+    }
+    printf("%d 行: 随机跳转 %d 次, 平均 %.3f ms/帧, 最慢 %.3f ms/帧, 总高度 %.0f px, %d 帧有空白\n",
+        items_count, jumps, total_ms / jumps, worst_ms, heights.GetTotalHeight(), gaps);
+    ImGui::DestroyContext(ctx);
+    return (errors == 0 && gaps == 0) ? 0 : 1;
+}
+
+// 多选存储基准测试（命令行参数 --bench-selection）：
+// 先用 bool 数组校验 ImGuiSelectionRangeStorage 的随机选择/取消选择，再在 1000 万项上比较逐项存储（ImGuiSelectionBasicStorage）
+// 与区间存储（ImGuiSelectionRangeStorage）：Ctrl+A 全选、Shift+点击取消一半、随机 Ctrl+点击、逐项查询。
+template <typename T>
+static void ApplySelectionRequest(T &selection, ImGuiSelectionRequestType type, bool selected, int items_count, int first = 0, int last = 0)
+{
+    ImGuiMultiSelectIO ms_io;
+    ImGuiSelectionRequest req = {type, selected, +1, first, last};
+    ms_io.Requests.push_back(req);
+    ms_io.ItemsCount = items_count;
+    selection.ApplyRequests(&ms_io);
+}
+
+template <typename T>
+static void RunSelectionBenchmarkOne(const char *name, T &selection, bool (*contains)(const T &, int), size_t (*memory)(const T &))
+{
+    const int items_count = 10000000;
+    const int clicks = 10000;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    ApplySelectionRequest(selection, ImGuiSelectionRequestType_SetAll, true, items_count);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    ApplySelectionRequest(selection, ImGuiSelectionRequestType_SetRange, false, items_count, items_count / 4, items_count / 4 * 3 - 1);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    ImU32 rng = 1234;
+    for (int n = 0; n < clicks; n++)
+    {
+        const int idx = (int)(ImDebugRandom(&rng) % (ImU32)items_count);
+        ApplySelectionRequest(selection, ImGuiSelectionRequestType_SetRange, !contains(selection, idx), items_count, idx, idx);
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    int selected = 0;
+    for (int idx = 0; idx < items_count; idx++)
+        selected += contains(selection, idx) ? 1 : 0;
+    auto t4 = std::chrono::high_resolution_clock::now();
+    printf("  %-6s 全选 %8.2f ms  取消一半 %8.2f ms  点击 %8.2f us/次  查询 %6.2f ns/次  选中 %d 项  占用 %.1f KB\n", name,
+        std::chrono::duration<double, std::milli>(t1 - t0).count(),
+        std::chrono::duration<double, std::milli>(t2 - t1).count(),
+        std::chrono::duration<double, std::micro>(t3 - t2).count() / clicks,
+        std::chrono::duration<double, std::nano>(t4 - t3).count() / items_count, selected, memory(selection) / 1024.0);
+}
+
+static int RunSelectionBenchmark()
+{
+    // 校验：与 bool 数组逐项比较选中数、查询结果与遍历结果
+    int errors = 0;
+    {
+        const int items_count = 1000;
+        ImGuiSelectionRangeStorage selection;
+        std::vector<bool> ref(items_count, false);
+        ImU32 rng = 5678;
+        auto next = [&rng]() { return ImDebugRandom(&rng); };
+        for (int n = 0; n < 20000; n++)
+        {
+            const int first = (int)(next() % items_count);
+            const int last = ImMin(first + (int)(next() % ((next() % 4) ? 5 : 200)), items_count - 1);
+            const bool selected = (next() % 2) != 0;
+            selection.SetRangeSelected(first, last, selected);
+            for (int idx = first; idx <= last; idx++)
+                ref[idx] = selected;
+            if (n % 100 != 0)
+                continue;
+            int ref_size = 0;
+            for (int idx = 0; idx < items_count; idx++)
+            {
+                ref_size += ref[idx] ? 1 : 0;
+                errors += (selection.Contains(idx) != ref[idx]);
+            }
+            errors += (selection.Size != ref_size);
+            void *it = NULL;
+            int idx = -1, prev_idx = -1, iterated = 0;
+            while (selection.GetNextSelectedItem(&it, &idx))
+            {
+                errors += (idx <= prev_idx || !ref[idx]);
+                prev_idx = idx;
+                iterated++;
+            }
+            errors += (iterated != ref_size);
+            it = NULL;
+            int range_first, range_last, prev_last = -2;
+            while (selection.GetNextSelectedRange(&it, &range_first, &range_last))
+            {
+                errors += (range_first <= prev_last + 1 || range_last < range_first); // 区间须有序、不重叠且不相邻
+                prev_last = range_last;
+            }
+        }
+    }
+    printf("区间存储校验: %d 处错误\n", errors);
+
+    printf("10000000 项:\n");
+    {
+        ImGuiSelectionBasicStorage selection;
+        RunSelectionBenchmarkOne<ImGuiSelectionBasicStorage>("逐项", selection,
+            [](const ImGuiSelectionBasicStorage &s, int idx) { return s.Contains((ImGuiID)idx); },
+            [](const ImGuiSelectionBasicStorage &s) { return (size_t)s._Storage.Data.Capacity * sizeof(ImGuiStoragePair) + (size_t)s._Storage.HashIndex.Capacity * sizeof(int); });
+    }
+    {
+        ImGuiSelectionRangeStorage selection;
+        RunSelectionBenchmarkOne<ImGuiSelectionRangeStorage>("区间", selection,
+            [](const ImGuiSelectionRangeStorage &s, int idx) { return s.Contains(idx); },
+            [](const ImGuiSelectionRangeStorage &s) { return (size_t)s._Ranges.Capacity * sizeof(int); });
+    }
+    return errors ? 1 : 0;
+}
+
+// 虚拟化树基准测试（命令行参数 --bench-tree）：
+// 三层共 51 万个节点（100 x 100 x 50）。先随机展开/折叠并与完整重建的结果比较，再全部展开后统计重建、单次展开/折叠
+// 与无窗口渲染（ImGuiListClipper 只提交可见行）的耗时，以及窗口 ImGuiStorage 中的条目数。
+struct BenchTree
+{
+    static const int Level0Count = 100, Level1Count = 100, Level2Count = 50;
+    static const int Level1Base = Level0Count, Level2Base = Level0Count + Level0Count * Level1Count;
+    static const int NodesCount = Level2Base + Level0Count * Level1Count * Level2Count;
+
+    static int GetChildrenCount(ImGuiVirtualTree *, int node_idx)
+    {
+        return (node_idx < 0) ? Level0Count : (node_idx < Level1Base) ? Level1Count : (node_idx < Level2Base) ? Level2Count : 0;
+    }
+    static int GetChild(ImGuiVirtualTree *, int node_idx, int child_n)
+    {
+        return (node_idx < 0) ? child_n : (node_idx < Level1Base) ? Level1Base + node_idx * Level1Count + child_n : Level2Base + (node_idx - Level1Base) * Level2Count + child_n;
+    }
+    static void Setup(ImGuiVirtualTree &tree)
+    {
+        tree.AdapterGetChildrenCount = GetChildrenCount;
+        tree.AdapterGetChild = GetChild;
+    }
+};
+
+static int RunTreeBenchmark()
+{
+    // 校验：增量更新的行数组须与按相同展开状态完整重建的结果一致
+    int errors = 0;
+    ImGuiVirtualTree tree;
+    BenchTree::Setup(tree);
+    tree.Build();
+    {
+        ImGuiVirtualTree reference;
+        BenchTree::Setup(reference);
+        ImU32 rng = 1234;
+        auto next = [&rng]() { return ImDebugRandom(&rng); };
+        for (int n = 0; n < 2000; n++)
+        {
+            if (next() % 2)
+                tree.SetRowOpen((int)(next() % (ImU32)tree.Rows.Size), (next() % 3) != 0);
+            else
+                tree.SetNodeOpen((int)(next() % (ImU32)BenchTree::Level2Base), (next() % 3) != 0);
+            if (n % 100 != 0)
+                continue;
+            reference._OpenBits = tree._OpenBits;
+            reference.Build();
+            errors += (reference.Rows.Size != tree.Rows.Size || memcmp(reference.Rows.Data, tree.Rows.Data, (size_t)tree.Rows.Size * sizeof(ImGuiVirtualTreeRow)) != 0);
+        }
+    }
+    printf("增量更新校验: %d 处错误\n", errors);
+
+    // 全部展开
+    tree.Clear();
+    for (int node_idx = 0; node_idx < BenchTree::Level2Base; node_idx++)
+        tree.SetNodeOpen(node_idx, true);
+    auto t0 = std::chrono::high_resolution_clock::now();
+    tree.Build();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    const int toggles = 200;
+    for (int n = 0; n < toggles; n++)
+        tree.SetRowOpen(0, !tree.IsNodeOpen(tree.Rows[0].NodeIdx)); // 第一个顶层节点：5100 个子孙行，且其后所有行都要移动
+    auto t2 = std::chrono::high_resolution_clock::now();
+    printf("%d 个节点, %d 行可见: 重建 %.2f ms, 展开/折叠 %.3f ms/次, 展开状态占用 %.1f KB\n", BenchTree::NodesCount, tree.Rows.Size,
+        std::chrono::duration<double, std::milli>(t1 - t0).count(), std::chrono::duration<double, std::milli>(t2 - t1).count() / toggles,
+        tree._OpenBits.Size * sizeof(ImU32) / 1024.0);
+
+    ImGuiContext *ctx = app::CreateHeadlessContext();
+    ImGuiIO &io = ImGui::GetIO();
+    int storage_entries = 0;
+    auto frame = [&](float scroll_y)
+    {
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("树", nullptr, ImGuiWindowFlags_NoSavedSettings);
+        if (scroll_y >= 0.0f)
+            ImGui::SetScrollY(scroll_y);
+        ImGuiListClipper clipper;
+        clipper.Begin(tree.Rows.Size);
+        while (clipper.Step())
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                char label[32];
+                snprintf(label, sizeof(label), "节点 %d", tree.Rows[row_n].NodeIdx);
+                tree.TreeNodeRow(row_n, label, ImGuiTreeNodeFlags_SpanAvailWidth);
+            }
+        tree.ApplyToggledRows();
+        storage_entries = ImGui::GetStateStorage()->Data.Size;
+        ImGui::End();
+    };
+    app::RunHeadlessFrame([&]() { frame(-1.0f); });
+    app::RunHeadlessFrame([&]() { frame(-1.0f); });
+    const int frames = 500;
+    auto t3 = std::chrono::high_resolution_clock::now();
+    for (int n = 0; n < frames; n++)
+        app::RunHeadlessFrame([&]() { frame((float)(((unsigned int)n * 104729u) % (unsigned int)tree.Rows.Size) * ImGui::GetTextLineHeightWithSpacing()); });
+    auto t4 = std::chrono::high_resolution_clock::now();
+    printf("随机滚动渲染 %d 帧: 平均 %.3f ms/帧, 窗口存储 %d 项\n", frames, std::chrono::duration<double, std::milli>(t4 - t3).count() / frames, storage_entries);
+    ImGui::DestroyContext(ctx);
+    return errors ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    for (int n = 1; n < argc; n++)
+        if (strcmp(argv[n], "--bench-atlas") == 0)
+            return RunAtlasBenchmark();
+        else if (strcmp(argv[n], "--bench-hash") == 0)
+            return RunHashBenchmark();
+        else if (strcmp(argv[n], "--bench-storage") == 0)
+            return RunStorageBenchmark();
+        else if (strcmp(argv[n], "--bench-clipper") == 0)
+            return RunClipperBenchmark();
+        else if (strcmp(argv[n], "--bench-selection") == 0)
+            return RunSelectionBenchmark();
+        else if (strcmp(argv[n], "--bench-tree") == 0)
+            return RunTreeBenchmark();
+    printf("用法: %s --bench-atlas|--bench-hash|--bench-storage|--bench-clipper|--bench-selection|--bench-tree\n", argv[0]);
+    return 1;
+}
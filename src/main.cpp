@@ -1,9 +1,21 @@
 #include "imgui.h"
+#include "imgui_internal.h"
 #include "imgui_impl_win32.h"
 #include "imgui_impl_dx11.h"
 #include <d3d11.h>
 #include <tchar.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "Application.hpp"
+#include "HeapProfiler.hpp"
+#include "Headless.hpp"
 // 数据
 static ID3D11Device *g_pd3dDevice = nullptr;
 static ID3D11DeviceContext *g_pd3dDeviceContext = nullptr;
@@ -22,11 +34,256 @@ LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 static int windows_size_width = 1000;
 static int windows_size_height = 900;
 
+// 设置文件后台写入：ImGui 在 UI 线程只生成需要改写的字节，写盘任务按提交顺序交给单个工作线程执行
+struct SettingsWriter
+{
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<std::pair<void (*)(void *), void *>> jobs;
+    bool quit = false;
+    std::thread thread;
+};
+static SettingsWriter g_SettingsWriter;
+
+static void SettingsWriterLoop()
+{
+    std::unique_lock<std::mutex> lock(g_SettingsWriter.mutex);
+    for (;;)
+    {
+        g_SettingsWriter.cond.wait(lock, [] { return g_SettingsWriter.quit || !g_SettingsWriter.jobs.empty(); });
+        if (g_SettingsWriter.jobs.empty())
+            return; // 退出前已写完所有任务
+        std::pair<void (*)(void *), void *> job = g_SettingsWriter.jobs.front();
+        g_SettingsWriter.jobs.pop_front();
+        lock.unlock();
+        job.first(job.second);
+        lock.lock();
+    }
+}
+
+static void SettingsWriteAsync(void *, void (*job_func)(void *job_data), void *job_data)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_SettingsWriter.mutex);
+        g_SettingsWriter.jobs.emplace_back(job_func, job_data);
+    }
+    g_SettingsWriter.cond.notify_one();
+}
+
+// 须在 DestroyContext() 之后调用：销毁上下文时还会提交最后一次保存
+static void SettingsWriterStop()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_SettingsWriter.mutex);
+        g_SettingsWriter.quit = true;
+    }
+    g_SettingsWriter.cond.notify_one();
+    g_SettingsWriter.thread.join();
+}
+
+// 字形并行光栅化线程池：启动时创建一次，FontParallelFor() 把一批任务交给工作线程，当前线程也领取任务，全部完成后返回。
+// 一批可能只有几个字形（文本中出现多个新字符时调用），逐批创建线程的开销与光栅化本身相当，因此复用常驻线程。
+struct FontWorkerPool
+{
+    std::mutex mutex;
+    std::condition_variable cond;     // 有新任务或退出
+    std::condition_variable doneCond; // 当前批次全部完成
+    void (*jobFunc)(void *job_data, int job_n) = nullptr;
+    void *jobData = nullptr;
+    int jobsCount = 0;
+    int nextJob = 0;     // 下一个未领取的任务
+    int pendingJobs = 0; // 未完成的任务
+    bool quit = false;
+    std::vector<std::thread> threads;
+};
+static FontWorkerPool g_FontWorkers;
+
+// 领取并执行当前批次的任务，直到没有未领取的任务；调用时须持有锁
+static void FontWorkersRunJobs(std::unique_lock<std::mutex> &lock)
+{
+    while (g_FontWorkers.nextJob < g_FontWorkers.jobsCount)
+    {
+        const int job_n = g_FontWorkers.nextJob++;
+        void (*job_func)(void *job_data, int job_n) = g_FontWorkers.jobFunc;
+        void *job_data = g_FontWorkers.jobData;
+        lock.unlock();
+        job_func(job_data, job_n);
+        lock.lock();
+        if (--g_FontWorkers.pendingJobs == 0)
+            g_FontWorkers.doneCond.notify_one();
+    }
+}
 
+static void FontWorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(g_FontWorkers.mutex);
+    for (;;)
+    {
+        g_FontWorkers.cond.wait(lock, [] { return g_FontWorkers.quit || g_FontWorkers.nextJob < g_FontWorkers.jobsCount; });
+        if (g_FontWorkers.quit)
+            return;
+        FontWorkersRunJobs(lock);
+    }
+}
+
+static void FontParallelFor(void *, int jobs_count, void (*job_func)(void *job_data, int job_n), void *job_data)
+{
+    std::unique_lock<std::mutex> lock(g_FontWorkers.mutex);
+    g_FontWorkers.jobFunc = job_func;
+    g_FontWorkers.jobData = job_data;
+    g_FontWorkers.jobsCount = jobs_count;
+    g_FontWorkers.nextJob = 0;
+    g_FontWorkers.pendingJobs = jobs_count;
+    g_FontWorkers.cond.notify_all();
+    FontWorkersRunJobs(lock);
+    g_FontWorkers.doneCond.wait(lock, [] { return g_FontWorkers.pendingJobs == 0; });
+    g_FontWorkers.jobsCount = g_FontWorkers.nextJob = 0;
+}
+
+// 创建 threads_count 个工作线程（为 0 时所有任务都在调用线程执行）
+static void FontWorkersStart(int threads_count)
+{
+    for (int n = 0; n < threads_count; n++)
+        g_FontWorkers.threads.emplace_back(FontWorkerLoop);
+}
+
+static void FontWorkersStop()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_FontWorkers.mutex);
+        g_FontWorkers.quit = true;
+    }
+    g_FontWorkers.cond.notify_all();
+    for (std::thread &thread : g_FontWorkers.threads)
+        thread.join();
+    g_FontWorkers.threads.clear();
+    g_FontWorkers.quit = false;
+}
+
+// 零分配测试（命令行参数 --test-zero-alloc [帧数]）：
+// 不创建窗口和 GPU 设备，用合成的 ImGuiIO 驱动 app::RenderUI() 与 Demo 窗口，预热之后的每一帧都不允许经过 ImGui 分配器。
+// 每帧的分配次数与调用栈由下面的分配器在分配时记录。字形光栅化工作线程（FontParallelFor）也会经过分配器，因此计数与记录位置都用原子操作，
+// 调用栈打印为 "模块 地址"（按模块首选基址换算，可直接用 addr2line -f -C -e MyRelaxImGUI.exe <地址> 解析）。
+struct ZeroAllocCallsite
+{
+    size_t size;
+    USHORT depth;
+    void *frames[24];
+};
+static std::atomic<bool> g_ZeroAllocCapture(false);
+static std::atomic<int> g_ZeroAllocCount(0); // 开始记录后的分配次数，可能超过记录的调用栈数
+static ZeroAllocCallsite g_ZeroAllocCallsites[32];
+
+static void *ZeroAllocTestAlloc(size_t size, void *)
+{
+    if (g_ZeroAllocCapture)
+    {
+        const int callsite_n = g_ZeroAllocCount++;
+        if (callsite_n < IM_ARRAYSIZE(g_ZeroAllocCallsites))
+        {
+            ZeroAllocCallsite &callsite = g_ZeroAllocCallsites[callsite_n];
+            callsite.size = size;
+            callsite.depth = ::CaptureStackBackTrace(1, IM_ARRAYSIZE(callsite.frames), callsite.frames, nullptr);
+        }
+    }
+    return malloc(size);
+}
+
+static void ZeroAllocTestFree(void *ptr, void *)
+{
+    free(ptr);
+}
+
+static void PrintZeroAllocCallsite(const ZeroAllocCallsite &callsite)
+{
+    printf("  分配 %zu 字节:\n", callsite.size);
+    for (USHORT n = 0; n < callsite.depth; n++)
+    {
+        ULONG_PTR address = (ULONG_PTR)callsite.frames[n];
+        const char *module_name = "?";
+        char module_path[MAX_PATH];
+        HMODULE module = nullptr;
+        if (::GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCSTR)callsite.frames[n], &module) &&
+            ::GetModuleFileNameA(module, module_path, MAX_PATH) > 0)
+        {
+            const IMAGE_DOS_HEADER *dos_header = (const IMAGE_DOS_HEADER *)module;
+            const IMAGE_NT_HEADERS *nt_headers = (const IMAGE_NT_HEADERS *)((const char *)module + dos_header->e_lfanew);
+            address = address - (ULONG_PTR)module + (ULONG_PTR)nt_headers->OptionalHeader.ImageBase;
+            module_name = strrchr(module_path, '\\') ? strrchr(module_path, '\\') + 1 : module_path;
+        }
+        printf("    #%-2d %s 0x%llx\n", (int)n, module_name, (unsigned long long)address);
+    }
+}
+
+static int RunZeroAllocTest(int frames)
+{
+    const int warmup_frames = 300;
+    const int mouse_period = 150; // 鼠标轨迹周期，须小于预热帧数，使悬停、提示框等状态在预热阶段都出现过
+
+    ImGui::SetAllocatorFunctions(ZeroAllocTestAlloc, ZeroAllocTestFree);
+    app::CreateHeadlessContext(ImVec2((float)windows_size_width, (float)windows_size_height));
+    ImGuiIO &io = ImGui::GetIO();
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_NavEnableGamepad;
+    io.ConfigDrawDataTrackChanges = true;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    ImGui::StyleColorsDark();
+
+    // 与正常启动相同的中文字体，找不到字体文件时使用默认字体
+    const char *font_path = "C:/Windows/Fonts/msyh.ttc";
+    if (ImFileHandle f = ImFileOpen(font_path, "rb"))
+    {
+        ImFileClose(f);
+        ImFontConfig font_cfg;
+        font_cfg.FontDataMapFile = true;
+        io.Fonts->AddFontFromFileTTF(font_path, 16.0f, &font_cfg, io.Fonts->GetGlyphRangesChineseFull());
+    }
+    io.Fonts->ParallelForFunc = FontParallelFor;
+    io.Fonts->ParallelForJobsMax = (int)std::thread::hardware_concurrency();
+    FontWorkersStart(io.Fonts->ParallelForJobsMax - 1); // 当前线程也执行任务
+
+    int failed_frames = 0;
+    for (int frame = 0; frame < warmup_frames + frames; frame++)
+    {
+        const float t = (float)(frame % mouse_period) / (float)mouse_period * 2.0f * IM_PI;
+        io.AddMousePosEvent(io.DisplaySize.x * (0.5f + 0.45f * cosf(t)), io.DisplaySize.y * (0.5f + 0.45f * sinf(t)));
+
+        const bool measure = (frame >= warmup_frames);
+        g_ZeroAllocCount = 0;
+        g_ZeroAllocCapture = measure;
+        app::RunHeadlessFrame([]()
+        {
+            app::RenderUI();
+            ImGui::ShowDemoWindow();
+        });
+        g_ZeroAllocCapture = false;
+
+        // FontParallelFor() 返回前已等待所有工作线程的任务完成，此时读取计数与记录的调用栈是安全的
+        const int allocs = g_ZeroAllocCount;
+        if (!measure || allocs == 0)
+            continue;
+        failed_frames++;
+        printf("第 %d 帧: %d 次分配\n", frame - warmup_frames, allocs);
+        const int callsites_count = ImMin(allocs, (int)IM_ARRAYSIZE(g_ZeroAllocCallsites));
+        for (int n = 0; n < callsites_count; n++)
+            PrintZeroAllocCallsite(g_ZeroAllocCallsites[n]);
+        if (allocs > callsites_count)
+            printf("  (其余 %d 次未记录调用栈)\n", allocs - callsites_count);
+    }
+    ImGui::DestroyContext();
+    FontWorkersStop();
+
+    printf("零分配测试: 预热 %d 帧后运行 %d 帧, %d 帧有分配 -> %s\n", warmup_frames, frames, failed_frames, failed_frames ? "失败" : "通过");
+    return failed_frames ? 1 : 0;
+}
 
 // 主代码
-int main(int, char **)
+int main(int argc, char **argv)
 {
+    // 命令行模式
+    for (int n = 1; n < argc; n++)
+        if (strcmp(argv[n], "--test-zero-alloc") == 0)
+            return RunZeroAllocTest((n + 1 < argc && atoi(argv[n + 1]) > 0) ? atoi(argv[n + 1]) : 600);
+
     // 创建应用程序窗口
     // ImGui_ImplWin32_EnableDpiAwareness();
     WNDCLASSEXW wc = {sizeof(wc), CS_CLASSDC, WndProc, 0L, 0L, GetModuleHandle(nullptr), nullptr, nullptr, nullptr, nullptr, L"ImGui Example", nullptr};
@@ -48,11 +305,17 @@ int main(int, char **)
 
     // 设置 Dear ImGui 上下文
     IMGUI_CHECKVERSION();
+    app::InstallHeapProfiler(); // 按子系统统计 ImGui 内存（F10 打开堆分析窗口），须在创建上下文之前安装
     ImGui::CreateContext();
     ImGuiIO &io = ImGui::GetIO();
     (void)io;
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // 启用键盘控制
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;  // 启用游戏手柄控制
+    io.ConfigDrawDataTrackChanges = true;                 // 检测画面是否变化，未变化时跳过渲染与呈现
+    io.ConfigMemoryCompactBudget = 16 * 1024 * 1024;      // ImGui 临时缓冲区与烘焙字体的内存上限，超出时优先释放最久未使用的
+    io.BinSettingsFilename = "imgui_settings.bin";        // 使用二进制设置文件（首次运行时导入 imgui.ini），只改写变化的条目
+    io.BinSettingsWriteFunc = SettingsWriteAsync;         // 在后台线程写盘
+    g_SettingsWriter.thread = std::thread(SettingsWriterLoop);
 
     // 设置 Dear ImGui 样式
     ImGui::StyleColorsDark();
@@ -61,17 +324,26 @@ int main(int, char **)
     ImGui_ImplWin32_Init(hwnd);
     ImGui_ImplDX11_Init(g_pd3dDevice, g_pd3dDeviceContext);
     // 加载中文字体（只需加载一次）
+    // 以只读内存映射方式打开字体文件：多个进程共享页面，且只有实际用到的部分才会被读入内存
+    ImFontConfig font_cfg;
+    font_cfg.FontDataMapFile = true;
     ImFont* font = io.Fonts->AddFontFromFileTTF(
         "C:/Windows/Fonts/msyh.ttc",   // 微软雅黑
         16.0f,
-        nullptr,
+        &font_cfg,
         io.Fonts->GetGlyphRangesChineseFull()
     );
+    io.Fonts->ParallelForFunc = FontParallelFor;
+    io.Fonts->ParallelForJobsMax = (int)std::thread::hardware_concurrency();
+    FontWorkersStart(io.Fonts->ParallelForJobsMax - 1); // 当前线程也执行任务
+    // 从磁盘字形缓存恢复上次已光栅化的字形（字体文件或设置变化时缓存条目自动失效）
+    io.Fonts->LoadGlyphCache("imgui_glyphs.bin");
 
     
     // 我们的状态
     
     ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
+    bool show_heap_profiler = false;
 
     // 主循环
     bool done = false;
@@ -117,15 +389,29 @@ int main(int, char **)
 
         app::RenderUI();
 
+        // F10 切换堆分析窗口
+        if (ImGui::IsKeyPressed(ImGuiKey_F10, false))
+            show_heap_profiler = !show_heap_profiler;
+        if (show_heap_profiler)
+            app::ShowHeapProfilerWindow(&show_heap_profiler);
+
         // 可选：如果用了 PushFont，渲染后要 PopFont
         // ImGui::PopFont();
 
         // 渲染
         ImGui::Render();
+
+        // 画面与上一帧完全相同：跳过清屏、绘制与呈现，交换链中保留的仍是上一帧的内容
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        if (!draw_data->ContentChanged)
+        {
+            ::Sleep(10);
+            continue;
+        }
         const float clear_color_with_alpha[4] = {clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w};
         g_pd3dDeviceContext->OMSetRenderTargets(1, &g_mainRenderTargetView, nullptr);
         g_pd3dDeviceContext->ClearRenderTargetView(g_mainRenderTargetView, clear_color_with_alpha);
-        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+        ImGui_ImplDX11_RenderDrawData(draw_data);
 
         // 呈现
         HRESULT hr = g_pSwapChain->Present(1, 0); // 使用垂直同步呈现
@@ -133,10 +419,15 @@ int main(int, char **)
         g_SwapChainOccluded = (hr == DXGI_STATUS_OCCLUDED);
     }
 
+    // 保存字形缓存，加快下次启动
+    io.Fonts->SaveGlyphCache("imgui_glyphs.bin");
+
     // 清理
     ImGui_ImplDX11_Shutdown();
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
+    FontWorkersStop();
+    SettingsWriterStop();
 
     CleanupDeviceD3D();
     ::DestroyWindow(hwnd);